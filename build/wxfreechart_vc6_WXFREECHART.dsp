@@ -916,6 +916,10 @@ SOURCE=..\src\chart.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\chartimage.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\chartpanel.cpp
 # End Source File
 # Begin Source File
@@ -944,6 +948,14 @@ SOURCE=..\src\axis\dateaxis.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\drawsurface.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\src\xy\functions\functiondataset.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\gantt\ganttdataset.cpp
 # End Source File
 # Begin Source File
@@ -960,6 +972,10 @@ SOURCE=..\src\gantt\ganttsimpledataset.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\xy\histogramdataset.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\axis\juliandateaxis.cpp
 # End Source File
 # Begin Source File
@@ -1020,10 +1036,18 @@ SOURCE=..\src\ohlc\ohlcsimpledataset.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\parallel.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\pie\pieplot.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\pixeloccupancy.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\plot.cpp
 # End Source File
 # Begin Source File
@@ -1032,10 +1056,18 @@ SOURCE=..\src\xy\functions\polynom.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\rastersurface.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\renderer.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\segmentclipper.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\xy\functions\sinefunction.cpp
 # End Source File
 # Begin Source File
@@ -1044,6 +1076,14 @@ SOURCE=..\src\symbol.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\textcache.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=..\src\tiledsurface.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\xy\timeseriesdataset.cpp
 # End Source File
 # Begin Source File
@@ -1060,6 +1100,10 @@ SOURCE=..\src\xy\vectordataset.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\vectorsurface.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\xy\xyarearenderer.cpp
 # End Source File
 # Begin Source File
@@ -1068,6 +1112,10 @@ SOURCE=..\src\xy\xydataset.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=..\src\xy\xydensityrenderer.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=..\src\xy\xydynamicdataset.cpp
 # End Source File
 # Begin Source File
@@ -1136,6 +1184,10 @@ SOURCE=..\include\wx\xyz\bubbleplot.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\canceltoken.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\axis\categoryaxis.h
 # End Source File
 # Begin Source File
@@ -1156,6 +1208,10 @@ SOURCE=..\include\wx\chart.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\chartimage.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\chartpanel.h
 # End Source File
 # Begin Source File
@@ -1192,10 +1248,18 @@ SOURCE=..\include\wx\drawobject.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\drawsurface.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\drawutils.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\xy\functions\functiondataset.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\gantt\ganttdataset.h
 # End Source File
 # Begin Source File
@@ -1212,6 +1276,10 @@ SOURCE=..\include\wx\gantt\ganttsimpledataset.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\xy\histogramdataset.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\axis\juliandateaxis.h
 # End Source File
 # Begin Source File
@@ -1280,10 +1348,18 @@ SOURCE=..\include\wx\ohlc\ohlcsimpledataset.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\parallel.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\pie\pieplot.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\pixeloccupancy.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\plot.h
 # End Source File
 # Begin Source File
@@ -1292,10 +1368,18 @@ SOURCE=..\include\wx\xy\functions\polynom.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\rastersurface.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\refobject.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\segmentclipper.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\xy\functions\sinefunction.h
 # End Source File
 # Begin Source File
@@ -1304,6 +1388,14 @@ SOURCE=..\include\wx\symbol.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\textcache.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\include\wx\tiledsurface.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\xy\timeseriesdataset.h
 # End Source File
 # Begin Source File
@@ -1320,6 +1412,10 @@ SOURCE=..\include\wx\xy\vectordataset.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\vectorsurface.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\wxfreechartdefs.h
 # End Source File
 # Begin Source File
@@ -1332,6 +1428,10 @@ SOURCE=..\include\wx\xy\xydataset.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\include\wx\xy\xydensityrenderer.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\include\wx\xy\xydynamicdataset.h
 # End Source File
 # Begin Source File
@@ -60,7 +60,7 @@ public:
 	 * @param borderPen pen to draw area border
 	 * @param fillBrush brush to fill area
 	 */
-	FillAreaDraw(wxPen borderPen = (wxPen) *wxBLACK_PEN, wxBrush fillBrush =  (wxBrush) *wxWHITE_BRUSH);
+	FillAreaDraw(wxPen borderPen = wxPen(*wxBLACK, 1, wxPENSTYLE_SOLID), wxBrush fillBrush =  wxBrush(*wxWHITE));
 
 	FillAreaDraw(wxColour borderColour, wxColour fillColour);
 
@@ -125,7 +125,7 @@ public:
 	 * @param colour2 second gradient fill color
 	 * @param dir gradient fill direction
 	 */
-	GradientAreaDraw(wxPen borderPen = *wxBLACK_PEN,
+	GradientAreaDraw(wxPen borderPen = wxPen(*wxBLACK, 1, wxPENSTYLE_SOLID),
 			wxColour colour1 = wxColour(200, 220, 250),
 			wxColour colour2 = wxColour(255, 255, 255),
 			wxDirection dir = wxEAST);
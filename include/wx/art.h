@@ -23,6 +23,14 @@ WX_DECLARE_HASH_MAP(int, Symbol *, wxIntegerHash, wxIntegerEqual, SymbolMap);
 
 wxColour WXDLLIMPEXP_FREECHART GetDefaultColour(size_t index);
 
+/**
+ * Returns default symbol for serie.
+ * Default symbols are shared by all charts. They are created on load,
+ * so they can be got from any thread. Their sprite cache is used only
+ * from main thread, worker threads draw shape symbols directly.
+ * @param index serie index
+ * @return default symbol
+ */
 Symbol WXDLLIMPEXP_FREECHART *GetDefaultSymbol(size_t index);
 
 #endif /*ART_H_*/
@@ -18,6 +18,8 @@
 #include <wx/drawobject.h>
 #include <wx/observable.h>
 
+#include <math.h>
+
 enum AXIS_LOCATION {
 	AXIS_LEFT = 1,
 	AXIS_RIGHT,
@@ -27,6 +29,120 @@ enum AXIS_LOCATION {
 
 class WXDLLIMPEXP_FREECHART Axis;
 
+/**
+ * Transform from data space to graphics space of axis, returned by
+ * Axis::GetTransform.
+ * It's calculated once for axis state and data area, and then values
+ * are transformed without virtual calls and axis bounds lookups.
+ * Linear transform is kept as scale and offset pair, logarithmic
+ * transform applies it to value logarithm. For other nonlinear
+ * axes transform calls Axis::ToGraphics for each value.
+ * Transform must not be used after axis or data area is changed.
+ */
+class WXDLLIMPEXP_FREECHART AxisTransform
+{
+public:
+	/**
+	 * Constructs linear transform, that maps all values to zero.
+	 */
+	AxisTransform();
+
+	/**
+	 * Constructs linear transform.
+	 * @param minCoord minimal graphics space coordinate
+	 * @param gRange graphics space range
+	 * @param minValue data value at minimal coordinate
+	 * @param maxValue data value at maximal coordinate
+	 * @param vertical true for vertical axis, values increase upward
+	 * @param logarithmic true to scale values logarithmically,
+	 * minValue and maxValue must be positive then
+	 */
+	AxisTransform(int minCoord, int gRange, double minValue, double maxValue, bool vertical, bool logarithmic = false);
+
+	/**
+	 * Constructs transform, that calls Axis::ToGraphics for each value.
+	 * Used for nonlinear axes.
+	 * @param axis axis
+	 * @param dc device context
+	 * @param minCoord minimal graphics space coordinate
+	 * @param gRange graphics space range
+	 */
+	AxisTransform(Axis *axis, wxDC &dc, int minCoord, int gRange);
+
+	/**
+	 * Transforms value from data space to graphics space.
+	 * @param value value in data space
+	 * @return coordinate in graphics space
+	 */
+	inline wxCoord ToGraphics(double value) const;
+
+	/**
+	 * Transforms array of values from data space to graphics space.
+	 * For linear transform loop has no calls and branches, so it
+	 * is vectorized by compiler. Logarithmic transform uses fast
+	 * logarithm approximation, that is exact to small fraction of pixel.
+	 * @param values values in data space
+	 * @param coords output coordinates in graphics space
+	 * @param count value count
+	 */
+	void ToGraphics(const double *values, wxCoord *coords, size_t count) const;
+
+	/**
+	 * Transforms array of values from data space to graphics space,
+	 * without rounding coordinates. Values far out of axis bounds give
+	 * coordinates, that don't fit wxCoord, so they are clipped in this
+	 * form (see SegmentClipper).
+	 * @param values values in data space
+	 * @param coords output coordinates in graphics space
+	 * @param count value count
+	 */
+	void ToGraphics(const double *values, double *coords, size_t count) const;
+
+	/**
+	 * Returns graphics space interval, where visible values are mapped.
+	 * For nonlinear axes, that call ToGraphics for each value, it's
+	 * whole interval, including axis margins.
+	 * @param minCoord output minimal coordinate
+	 * @param maxCoord output maximal coordinate
+	 */
+	void GetCoordRange(wxCoord &minCoord, wxCoord &maxCoord) const
+	{
+		minCoord = m_minCoord;
+		maxCoord = m_minCoord + m_gRange;
+	}
+
+	/**
+	 * Checks whether transform is linear.
+	 * @return true if transform is linear
+	 */
+	bool IsLinear() const
+	{
+		return m_axis == NULL && !m_logarithmic;
+	}
+
+	/**
+	 * Checks whether transform is calculated without axis calls.
+	 * Only such transforms can be used from worker threads.
+	 * @return true if transform doesn't call axis
+	 */
+	bool IsPrecomputed() const
+	{
+		return m_axis == NULL;
+	}
+
+private:
+	// for logarithmic transform, scale is for natural logarithm of value
+	double m_scale;
+	double m_offset;
+	bool m_logarithmic;
+
+	// axis and drawing params, for nonlinear transform
+	Axis *m_axis;
+	wxDC *m_dc;
+	int m_minCoord;
+	int m_gRange;
+};
+
 /**
  * Interface to receive axis events.
  */
@@ -181,6 +297,15 @@ public:
 		}
 	}
 
+	/**
+	 * Checks whether window is used.
+	 * @return true if window is used
+	 */
+	bool GetUseWindow()
+	{
+		return m_useWin;
+	}
+
 	/**
 	 * Sets window params (position and width). Window params are in data space.
 	 * @param winPos new window position
@@ -283,6 +408,20 @@ public:
 	 */
 	virtual double ToData(wxDC &dc, int minCoord, int gRange, wxCoord g);
 
+	/**
+	 * Returns transform from data space to graphics space for current
+	 * axis state, used to transform many values at once.
+	 * Default implementation returns transform, that calls ToGraphics
+	 * for each value, so it's correct for any derivative class.
+	 * Axes with linear or logarithmic ToGraphics override it to
+	 * return precomputed transform.
+	 * @param dc device context
+	 * @param minCoord minimal graphics space coordinate
+	 * @param gRange graphics space range
+	 * @return transform
+	 */
+	virtual AxisTransform GetTransform(wxDC &dc, int minCoord, int gRange);
+
 	/**
 	 * Performs axis bounds update after dataset/s change.
 	 */
@@ -312,6 +451,15 @@ protected:
 	 */
 	virtual bool AcceptDataset(Dataset *dataset) = 0;
 
+	/**
+	 * Returns linear transform for current axis state and window.
+	 * It's used by default implementation of ToGraphics.
+	 * @param minCoord minimal graphics space coordinate
+	 * @param gRange graphics space range
+	 * @return transform
+	 */
+	AxisTransform GetLinearTransform(int minCoord, int gRange);
+
 	DatasetArray m_datasets;
 	wxPen m_gridLinesPen;
 
@@ -368,6 +516,8 @@ public:
 
 	virtual double ToData(wxDC &dc, int minCoord, int gRange, wxCoord g);
 
+	virtual AxisTransform GetTransform(wxDC &dc, int minCoord, int gRange);
+
 	virtual void UpdateBounds();
 
 	virtual void Draw(wxDC &dc, wxRect rc);
@@ -383,6 +533,17 @@ private:
 	Axis *m_axis;
 };
 
+inline wxCoord AxisTransform::ToGraphics(double value) const
+{
+	if (m_axis != NULL) {
+		return m_axis->ToGraphics(*m_dc, m_minCoord, m_gRange, value);
+	}
+	if (m_logarithmic) {
+		return (wxCoord) (log(value) * m_scale + m_offset);
+	}
+	return (wxCoord) (value * m_scale + m_offset);
+}
+
 wxCoord ToGraphics(int minCoord, int gRange, double minValue, double maxValue, wxCoord margin, bool vertical, double value);
 double ToData(int minCoord, int gRange, double minValue, double maxValue, wxCoord margin, bool vertical, wxCoord g);
 
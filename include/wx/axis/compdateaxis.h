@@ -44,6 +44,8 @@ public:
 
 	virtual double ToData(wxDC &dc, int minCoord, int gRange, wxCoord g);
 
+	virtual AxisTransform GetTransform(wxDC &dc, int minCoord, int gRange);
+
 	/**
 	 * Adds interval.
 	 */
@@ -85,6 +87,11 @@ private:
 
 	size_t m_dateCount;
 
+	// first and last dates, rounded to minimal span
+	bool m_datesValid;
+	wxDateTime m_firstDate;
+	wxDateTime m_lastDate;
+
 	bool m_fillDateGaps;
 
 	wxFont m_labelFont;
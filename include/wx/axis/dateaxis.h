@@ -53,6 +53,8 @@ protected:
 
 	virtual wxSize GetLongestLabelExtent(wxDC &dc);
 
+	virtual void GetStepRange(wxDC &dc, wxRect rc, size_t &first, size_t &last, size_t &stride);
+
 private:
 	size_t m_dateCount;
 
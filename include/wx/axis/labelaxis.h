@@ -225,6 +225,13 @@ public:
 
 	virtual wxCoord GetExtent(wxDC &dc);
 
+	/**
+	 * Returns linear transform, because label axes use default
+	 * Axis::ToGraphics. Derivative classes, that override ToGraphics,
+	 * must override this method too.
+	 */
+	virtual AxisTransform GetTransform(wxDC &dc, int minCoord, int gRange);
+
 	/**
 	 * Enables a subdivision of the major ticks
 	 * @param enable true for enable, false for disable
@@ -259,6 +266,19 @@ protected:
 
 	virtual wxSize GetLongestLabelExtent(wxDC &dc) = 0;
 
+	/**
+	 * Returns steps, iterated to draw labels and grid lines.
+	 * Derivative classes with many steps override it to iterate
+	 * only steps inside axis window, and to skip labels, that
+	 * don't fit. Default implementation returns all steps.
+	 * @param dc device context
+	 * @param rc axis or data area rectangle
+	 * @param first output first step
+	 * @param last output last step
+	 * @param stride output distance between iterated steps
+	 */
+	virtual void GetStepRange(wxDC &dc, wxRect rc, size_t &first, size_t &last, size_t &stride);
+
 	virtual bool HasLabels();
 
 	bool m_enableSubticks;
@@ -52,6 +52,11 @@ public:
 	 */
 	virtual double ToData(wxDC &dc, int minCoord, int gRange, wxCoord g);
 
+	/**
+	 * Overwrites Axis::GetTransform to get logarithmic scaling.
+	 */
+	virtual AxisTransform GetTransform(wxDC &dc, int minCoord, int gRange);
+
 protected:
     virtual bool AcceptDataset(Dataset *dataset);
     virtual void AutomaticTicksCalc();
@@ -59,6 +64,12 @@ protected:
 	virtual double GetValue(size_t step);
 
 private:
+	/**
+	 * Returns bounds of visible values: window bounds, if window is used,
+	 * or data bounds.
+	 */
+	void GetVisibleBounds(double &minValue, double &maxValue);
+
 	bool m_longExponent;
 
 	double m_logBase;
@@ -111,6 +111,13 @@ private:
 	wxString m_tickFormat;
 	bool m_intValues;
 	double m_multiplier;
+
+	// formatted bounds labels, used to measure longest label
+	wxString m_boundsFormat;
+	double m_boundsMinValue;
+	double m_boundsMaxValue;
+	wxString m_minLabel;
+	wxString m_maxLabel;
 };
 
 #endif /*NUMBERAXIS_H_*/
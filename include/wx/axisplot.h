@@ -18,9 +18,16 @@
 #include <wx/marker.h>
 #include <wx/crosshair.h>
 #include <wx/chartpanel.h>
+#include <wx/drawsurface.h>
 
 #include <wx/dynarray.h>
 
+#if wxUSE_THREADS
+#include <wx/thread.h>
+#endif /* wxUSE_THREADS */
+
+#include <vector>
+
 
 /**
  * Internal class, don't use in your applications.
@@ -183,6 +190,60 @@ public:
 	 */
 	void SetDrawGrid(bool drawGridVertical, bool drawGridHorizontal);
 
+	/**
+	 * Sets whether to render datasets to memory buffer instead of
+	 * device context. Buffer rendering is much faster for large datasets,
+	 * but supports only solid pens.
+	 * @param rasterRendering true to render datasets to memory buffer
+	 */
+	void SetRasterRendering(bool rasterRendering);
+
+	/**
+	 * Checks whether datasets are rendered to memory buffer.
+	 * @return true if datasets are rendered to memory buffer
+	 */
+	bool GetRasterRendering()
+	{
+		return m_rasterRendering;
+	}
+
+	/**
+	 * Sets whether to rasterize datasets in several threads, when
+	 * they are rendered to memory buffer. Data area is split to
+	 * horizontal tiles, which are rasterized in parallel.
+	 * @param parallelRendering true to rasterize datasets in several threads
+	 */
+	void SetParallelRendering(bool parallelRendering);
+
+	/**
+	 * Checks whether datasets are rasterized in several threads.
+	 * @return true if datasets are rasterized in several threads
+	 */
+	bool GetParallelRendering()
+	{
+		return m_parallelRendering;
+	}
+
+	/**
+	 * Sets strip chart mode. Used for live data, when horizontal axis window
+	 * follows newest data. In this mode data area is cached, and when window
+	 * moves, cached image is scrolled and only newly exposed part and
+	 * appended data are drawn.
+	 * Works when plot has one horizontal axis, that uses window, and data
+	 * is changed only by appending, otherwise data area is redrawn entirely.
+	 * @param stripChart true to turn strip chart mode on
+	 */
+	void SetStripChart(bool stripChart);
+
+	/**
+	 * Checks whether strip chart mode is on.
+	 * @return true if strip chart mode is on
+	 */
+	bool GetStripChart()
+	{
+		return m_stripChart;
+	}
+
 	/**
 	 * Sets background for data area.
 	 * @param dataBackground background for data area
@@ -201,8 +262,18 @@ public:
 	 */
 	void SetCrosshair(Crosshair *crosshair);
 
+	/**
+	 * Drops cached layout (data and legend areas), so it will be
+	 * calculated again on next drawing. Called, when axes, legend
+	 * or datasets are changed.
+	 */
+	void InvalidateLayout();
+
 	/**
 	 * Translate coordinate from graphics to data space.
+	 * Uses layout cached by last drawing, if plot rectangle is the same.
+	 * Must be called from main thread. Fails while chart panel draws
+	 * chart in background, because layout uses axes and legend.
 	 * @param nData number of dataset
 	 * @param dc device context
 	 * @param rc plot rectangle
@@ -224,6 +295,10 @@ public:
 	//
 	virtual void DatasetChanged(Dataset *dataset);
 
+	virtual void DatasetMarkersChanged(Dataset *dataset);
+
+	virtual void DatasetRendererChanged(Dataset *dataset);
+
 	//
 	// AxisObserver
 	//
@@ -262,6 +337,31 @@ protected:
 	 */
 	virtual void DrawDatasets(wxDC &dc, wxRect rc) = 0;
 
+	/**
+	 * Called to draw all datasets to drawing surface.
+	 * Default implementation flushes surface and draws datasets
+	 * to its device context.
+	 * @param surface drawing surface
+	 * @param rc rectangle where to draw
+	 */
+	virtual void DrawDatasets(DrawSurface &surface, wxRect rc);
+
+	/**
+	 * Called in strip chart mode to check whether datasets were changed
+	 * only by appending data since previous call.
+	 * Default implementation returns false, so data area is redrawn entirely.
+	 * @param minX output for minimal x value of appended data and
+	 * segments connecting it with old data, not changed if nothing appended
+	 * @return true if data was changed only by appending
+	 */
+	virtual bool FindAppendedData(double &minX);
+
+	/**
+	 * Notifies observers, that plot need to be redrawn, and drops
+	 * cached strip chart image.
+	 */
+	void FirePlotNeedRedraw();
+
 	wxCoord GetAxesExtent(wxDC &dc, AxisArray *axes);
 
 private:
@@ -270,6 +370,8 @@ private:
 	//
 	virtual void DrawData(wxDC &dc, wxRect rc);
 
+	virtual void DrawDataLayers(wxDC &dc, wxRect rc, int layers);
+
 	virtual bool HasData();
 
 	virtual void ChartPanelChanged(wxChartPanel *oldPanel, wxChartPanel *newPanel);
@@ -282,7 +384,8 @@ private:
 	//
 
 	/**
-	 * Calculate data area.
+	 * Calculate data area. Result is cached for plot rectangle, until
+	 * layout is invalidated (see InvalidateLayout).
 	 * @param dc device context
 	 * @param rc whole plot rectangle
 	 * @param rcData output data area rectangle
@@ -290,6 +393,15 @@ private:
 	 */
 	void CalcDataArea(wxDC &dc, wxRect rc, wxRect &rcData, wxRect &rcLegend);
 
+	/**
+	 * Performs data area calculation: measures legend and axes.
+	 * @param dc device context
+	 * @param rc whole plot rectangle
+	 * @param rcData output data area rectangle
+	 * @param rcLegent output rectangle for legend
+	 */
+	void LayoutDataArea(wxDC &dc, wxRect rc, wxRect &rcData, wxRect &rcLegend);
+
 	/**
 	 * Draws all axes.
 	 * @param dc device context
@@ -323,11 +435,43 @@ private:
 	void DrawMarkers(wxDC &dc, wxRect rcData);
 
 	/**
-	 * Draws data.
+	 * Draws data area layers.
 	 * @param dc device context
 	 * @param rcData data area rectangle
+	 * @param layers layers to draw, combination of CHART_LAYER values
 	 */
-	void DrawDataArea(wxDC &dc, wxRect rcData);
+	void DrawDataArea(wxDC &dc, wxRect rcData, int layers);
+
+	/**
+	 * Draws datasets without clipping.
+	 * @param dc device context
+	 * @param rcData data area rectangle
+	 * @param clipRc rectangle, where datasets are drawn
+	 */
+	void DrawDatasetsArea(wxDC &dc, wxRect rcData, wxRect clipRc);
+
+	/**
+	 * Returns horizontal axis, used to scroll strip chart,
+	 * or NULL if strip chart can't be drawn.
+	 * @return horizontal axis
+	 */
+	Axis *GetStripAxis();
+
+	/**
+	 * Draws data area in strip chart mode.
+	 * @param dc device context
+	 * @param rcData data area rectangle
+	 */
+	void DrawStripChart(wxDC &dc, wxRect rcData);
+
+	/**
+	 * Draws parts of data area to strip chart image.
+	 * @param dc device context, strip chart is drawn to
+	 * @param rcData data area rectangle
+	 * @param parts parts of data area to draw
+	 * @param count count of parts
+	 */
+	void DrawStripParts(wxDC &dc, wxRect rcData, const wxRect *parts, size_t count);
 
 	/**
 	 * Draws legend.
@@ -339,6 +483,32 @@ private:
 	bool m_drawGridVertical;
 	bool m_drawGridHorizontal;
 
+	bool m_rasterRendering;
+	bool m_parallelRendering;
+
+	// strip chart cache
+	bool m_stripChart;
+	bool m_stripValid;
+	wxBitmap m_stripBitmap;
+	wxBitmap m_stripShiftBitmap;
+	wxRect m_stripRect;
+	double m_stripWinPos; // window position, cached image is drawn for
+	double m_stripWinWidth;
+	double m_stripAxisWinPos; // last known window position of horizontal axis
+	std::vector<double> m_stripVertBounds;
+
+	// layout cache
+	bool m_layoutValid;
+	wxRect m_layoutRect; // plot rectangle, layout is calculated for
+	wxSize m_layoutPPI;
+	bool m_layoutAntialiased; // layout is calculated for graphics context
+	wxRect m_layoutData;
+	wxRect m_layoutLegend;
+	wxFont m_layoutLegendFont;
+#if wxUSE_THREADS
+	wxCriticalSection m_layoutLock;
+#endif
+
 	AxisArray m_leftAxes;
 	AxisArray m_rightAxes;
 	AxisArray m_topAxes;
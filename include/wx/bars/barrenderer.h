@@ -195,6 +195,9 @@ public:
 	double GetMinValue(CategoryDataset *dataset);
 	double GetMaxValue(CategoryDataset *dataset);
 
+protected:
+	virtual void ResolveSerieStyle(size_t serie, SerieStyle &style);
+
 private:
 	BarType *m_barType;
 
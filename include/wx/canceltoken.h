@@ -0,0 +1,50 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	canceltoken.h
+// Purpose: drawing cancellation token declaration
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef CANCELTOKEN_H_
+#define CANCELTOKEN_H_
+
+#include <wx/wxfreechartdefs.h>
+
+/**
+ * Token used to cancel drawing, performed in other thread.
+ * Drawing code checks it from time to time, and stops drawing
+ * as soon as possible after cancellation.
+ */
+class WXDLLIMPEXP_FREECHART CancelToken
+{
+public:
+	CancelToken()
+	{
+		m_cancelled = false;
+	}
+
+	/**
+	 * Requests cancellation. Can be called from any thread.
+	 */
+	void Cancel()
+	{
+		m_cancelled = true;
+	}
+
+	/**
+	 * Checks whether cancellation is requested.
+	 * @return true if cancellation is requested
+	 */
+	bool IsCancelled() const
+	{
+		return m_cancelled;
+	}
+
+private:
+	// only set once, so no locking needed
+	volatile bool m_cancelled;
+};
+
+#endif /*CANCELTOKEN_H_*/
@@ -47,6 +47,14 @@ public:
 	 * @param chart chart
 	 */
 	virtual void ChartScrollsChanged(Chart *chart) = 0;
+
+	/**
+	 * Called when some of chart layers has been changed.
+	 * Default implementation calls ChartChanged.
+	 * @param chart chart that has been changed
+	 * @param layers changed layers, combination of CHART_LAYER values
+	 */
+	virtual void ChartLayersChanged(Chart *chart, int layers);
 };
 
 /**
@@ -82,6 +90,18 @@ public:
 	 */
 	void Draw(wxDC &dc, wxRect &rc);
 
+	/**
+	 * Draws chart layers.
+	 * @param dc device context
+	 * @param rc rectangle where to draw chart
+	 * @param layers layers to draw, combination of CHART_LAYER values
+	 * @param cancel token to cancel drawing, or NULL
+	 * @param sampleLimit maximal count of points per serie to draw coarse
+	 * preview, or 0 to draw all points
+	 * @return true if some serie was drawn coarse, and must be refined
+	 */
+	bool DrawLayers(wxDC &dc, wxRect &rc, int layers, CancelToken *cancel = NULL, size_t sampleLimit = 0);
+
 	/**
 	 * Sets chart background.
 	 * @param background chart background
@@ -148,6 +168,8 @@ public:
 	//
 	virtual void PlotNeedRedraw(Plot *plot);
 
+	virtual void PlotLayersNeedRedraw(Plot *plot, int layers);
+
 	//
 	// AxisObserver
 	//
@@ -173,6 +195,8 @@ private:
 
 	FIRE_WITH_THIS(ChartChanged);
 	FIRE_WITH_THIS(ChartScrollsChanged);
+
+	void FireChartLayersChanged(int layers);
 };
 
 #endif /*CHART_H_*/
@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	chartimage.h
+// Purpose: chart to image renderer declaration
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef CHARTIMAGE_H_
+#define CHARTIMAGE_H_
+
+#include <wx/wxfreechartdefs.h>
+#include <wx/chart.h>
+
+#include <vector>
+
+/**
+ * Renders chart to image without window, eg. to save it to file.
+ *
+ * When wxUSE_GRAPHICS_CONTEXT is set in wxWidgets build, chart is drawn
+ * using graphics context on image, so renderer can be used from any thread.
+ * Rendering takes no global locks: independent charts can be rendered from
+ * several threads at once, and while main thread draws chart panels.
+ * Charts are independent, when they don't share datasets, and don't share
+ * fonts, pens and brushes with each other (wxWidgets objects share data
+ * with reference counter, that isn't thread safe). Default fonts are
+ * created for each chart (see CopyFont), and renderers construct pens
+ * and brushes while drawing. Default symbols are shared by all charts,
+ * they are created on load and drawn without changing them from worker
+ * threads (see GetDefaultSymbol).
+ * Chart must not be changed while it's rendered.
+ */
+class WXDLLIMPEXP_FREECHART ChartImageRenderer
+{
+public:
+	/**
+	 * Constructs new renderer.
+	 * @param chart chart to render, renderer doesn't take ownership
+	 * @param antialias true to draw antialiased
+	 */
+	ChartImageRenderer(Chart *chart, bool antialias = true);
+	virtual ~ChartImageRenderer();
+
+	/**
+	 * Turn antialiasing on/off.
+	 * @param antialias true to turn on antialiasing
+	 */
+	void SetAntialias(bool antialias)
+	{
+		m_antialias = antialias;
+	}
+
+	/**
+	 * Checks whether antialiasing is enabled.
+	 * @return true if antialiasing is enabled
+	 */
+	bool GetAntialias()
+	{
+		return m_antialias;
+	}
+
+	/**
+	 * Renders chart to image.
+	 * @param size image size
+	 * @return chart image, or invalid image if chart can't be rendered
+	 */
+	wxImage Render(wxSize size);
+
+	/**
+	 * Renders chart laid out for one size to several images of different
+	 * sizes. Chart is laid out for layout size, and drawing is scaled to
+	 * image size, so all images have the same layout: positions of titles,
+	 * axis labels and legend, and count of ticks.
+	 * Chart is laid out and drawn again for each image. Raster rendering
+	 * isn't used for scaled drawing, so datasets are drawn with device
+	 * context, unless scale is 1.
+	 * @param layoutSize size, chart is laid out for
+	 * @param scales scale factors, image size is layout size multiplied by scale
+	 * @param images output for images, invalid images for scales chart
+	 * can't be rendered with
+	 */
+	void Render(wxSize layoutSize, const std::vector<double> &scales, std::vector<wxImage> &images);
+
+	/**
+	 * Renders chart to image file. Image handler for file type must be
+	 * added before (see wxImage::AddHandler).
+	 * @param filename file name
+	 * @param size image size
+	 * @param type image file type
+	 * @return true if image is saved
+	 */
+	bool SaveFile(const wxString &filename, wxSize size, wxBitmapType type = wxBITMAP_TYPE_PNG);
+
+#if wxUSE_SVG
+	/**
+	 * Renders chart to SVG file. Chart is written to file while it's drawn,
+	 * and data lines are simplified at output resolution, so large
+	 * datasets produce files of reasonable size.
+	 * @param filename file name
+	 * @param size drawing size
+	 * @return true if file is written
+	 */
+	bool SaveSVGFile(const wxString &filename, wxSize size);
+#endif /* wxUSE_SVG */
+
+private:
+	/**
+	 * Draws chart to image.
+	 * @param image output image
+	 * @param layoutSize size, chart is laid out for
+	 * @param scale drawing scale
+	 * @return true if chart is drawn
+	 */
+	bool Draw(wxImage &image, wxSize layoutSize, double scale);
+
+	Chart *m_chart;
+	bool m_antialias;
+};
+
+#endif /*CHARTIMAGE_H_*/
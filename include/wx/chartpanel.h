@@ -13,7 +13,12 @@
 #include <wx/wxfreechartdefs.h>
 #include <wx/chart.h>
 
+#include <wx/timer.h>
+
+#include <vector>
+
 class wxChartPanel;
+class ChartRenderThread;
 
 /**
  * Interface to propagate chart panel mouse events
@@ -91,6 +96,117 @@ public:
 	 */
 	bool GetAntialias();
 
+	/**
+	 * Sets maximal frame rate. Chart changes are accumulated,
+	 * and chart is redrawn not often than once per frame interval.
+	 * @param maxFps maximal frames per second, 0 to redraw
+	 * as soon as possible after changes
+	 */
+	void SetMaxFps(int maxFps);
+
+	/**
+	 * Returns maximal frame rate.
+	 * @return maximal frames per second
+	 */
+	int GetMaxFps()
+	{
+		return m_maxFps;
+	}
+
+	/**
+	 * Redraws pending changes immediately, without waiting for
+	 * next frame. Should be called before using back buffer.
+	 * Cancels background rendering, if it's in progress.
+	 */
+	void RenderNow();
+
+	/**
+	 * Turn background rendering on/off. When it's on, chart is drawn
+	 * in worker thread, and panel shows last drawn chart image until
+	 * new one is ready. Rendering of outdated chart is cancelled, when
+	 * chart is changed again.
+	 * Has effect only when wxUSE_THREADS and wxUSE_GRAPHICS_CONTEXT
+	 * are set in wxWidgets build. Chart is drawn using graphics context,
+	 * so it's always antialiased, unless graphics renderer can't turn
+	 * antialiasing off.
+	 * Panel doesn't wait for worker thread: when chart is changed, outdated
+	 * rendering is cancelled, and changed layers are drawn after worker
+	 * thread stops. Scrollbars scroll axes after worker thread stops too.
+	 * Drawing code doesn't use global pen and brush lists, so they can be
+	 * used by main thread meanwhile.
+	 * Warning: chart, its axes and datasets must not be changed by program
+	 * while chart is rendered, call WaitRendering before changing them.
+	 *
+	 * @param asyncRendering true to turn on background rendering
+	 */
+	void SetAsyncRendering(bool asyncRendering);
+
+	/**
+	 * Checks whether background rendering is enabled.
+	 * @return true if background rendering is enabled
+	 */
+	bool GetAsyncRendering()
+	{
+		return m_asyncRendering;
+	}
+
+	/**
+	 * Cancels background rendering in progress without waiting for
+	 * worker thread. Changed layers are drawn again after it stops.
+	 */
+	void CancelRendering();
+
+	/**
+	 * Cancels background rendering in progress, and waits until
+	 * worker thread stops. Changed layers are drawn again with next frame.
+	 * Must be called from main thread before chart is changed,
+	 * when background rendering is turned on.
+	 */
+	void WaitRendering();
+
+	/**
+	 * Checks whether chart is drawn in worker thread now.
+	 * @return true if background rendering is in progress
+	 */
+	bool IsRendering();
+
+	/**
+	 * Turn progressive rendering on/off. When it's on, first frame
+	 * after chart change draws coarse preview of datasets, using only
+	 * part of points (see SetCoarseSampleLimit). Preview is replaced by
+	 * exact drawing, when changes stop for frame interval (see SetMaxFps).
+	 * Exact drawing is done in worker thread, when background rendering
+	 * is turned on. Preview isn't refined, when no serie has more points
+	 * than coarse sample limit.
+	 *
+	 * @param progressiveRendering true to turn on progressive rendering
+	 */
+	void SetProgressiveRendering(bool progressiveRendering);
+
+	/**
+	 * Checks whether progressive rendering is enabled.
+	 * @return true if progressive rendering is enabled
+	 */
+	bool GetProgressiveRendering()
+	{
+		return m_progressiveRendering;
+	}
+
+	/**
+	 * Sets maximal count of points per serie drawn in coarse preview.
+	 * @param coarseSampleLimit maximal point count
+	 */
+	void SetCoarseSampleLimit(size_t coarseSampleLimit);
+
+	/**
+	 * Returns maximal count of points per serie drawn in coarse preview.
+	 * @return maximal point count
+	 */
+	size_t GetCoarseSampleLimit()
+	{
+		return m_coarseSampleLimit;
+	}
+
 	/**
 	 * Returns back buffer copy as wxBitmap.
 	 * Can be used to save chart image to file.
@@ -105,11 +221,83 @@ public:
 
 	virtual void ChartScrollsChanged(Chart *chart);
 
+	virtual void ChartLayersChanged(Chart *chart, int layers);
+
 private:
 	void ResizeBackBitmap(wxSize size);
-	void RedrawBackBitmap();
+
+	/**
+	 * Redraws changed layers and layers, that depend on them, and
+	 * composes back buffer from them.
+	 * @param layers changed layers, combination of CHART_LAYER values
+	 * @param sampleLimit maximal count of points per serie to draw coarse
+	 * preview, or 0 to draw all points
+	 * @return true if some serie was drawn coarse
+	 */
+	bool RedrawBackBitmap(int layers = CHART_LAYER_ALL, size_t sampleLimit = 0);
+
+	/**
+	 * Draws chart layer to bitmap over copy of layers below it.
+	 * @param bitmap bitmap where to draw
+	 * @param below bitmap with layers below, or NULL
+	 * @param layer layer to draw
+	 * @param sampleLimit maximal count of points per serie, or 0
+	 * @return true if some serie was drawn coarse
+	 */
+	bool DrawLayer(wxBitmap &bitmap, wxBitmap *below, int layer, size_t sampleLimit);
+
+	/**
+	 * Draws datasets to data layer bitmap. It's drawn with transparent
+	 * background, when graphics context is available, otherwise it's
+	 * drawn over copy of markers layer.
+	 * @param sampleLimit maximal count of points per serie, or 0
+	 * @return true if some serie was drawn coarse
+	 */
+	bool DrawDataLayer(size_t sampleLimit);
+
+	/**
+	 * Redraws pending changes to back buffer in main thread.
+	 * When worker thread is drawing chart, it's cancelled without
+	 * waiting, and changes are drawn after it stops.
+	 * @param sampleLimit maximal count of points per serie to draw coarse
+	 * preview, or 0 to draw all points
+	 */
+	void Render(size_t sampleLimit);
+
+	/**
+	 * Marks layers as changed, and schedules redraw.
+	 * @param layers changed layers, combination of CHART_LAYER values
+	 */
+	void ScheduleRedraw(int layers);
+
+	/**
+	 * Starts drawing of chart in worker thread.
+	 */
+	void StartRendering();
+
 	void RecalcScrollbars();
 
+	/**
+	 * Sets axis window position. While chart is drawn in worker thread,
+	 * rendering is cancelled, and position is set after thread stops.
+	 * @param axis axis to scroll
+	 * @param winPos new window position
+	 */
+	void SetAxisWindowPosition(Axis *axis, double winPos);
+
+	/**
+	 * Returns axis window position, including pending scroll.
+	 * @param axis axis
+	 * @return window position
+	 */
+	double GetAxisWindowPosition(Axis *axis);
+
+	/**
+	 * Scrolls axes, that were scrolled while chart was drawn
+	 * in worker thread.
+	 */
+	void ApplyPendingScrolls();
+
 	//
 	// Event handlers
 	//
@@ -117,15 +305,54 @@ private:
 	void OnSize(wxSizeEvent &ev);
 	void OnScrollWin(wxScrollWinEvent &ev);
 	void OnMouseEvents(wxMouseEvent &ev);
+	void OnRedrawTimer(wxTimerEvent &ev);
+	void OnRenderDone(wxThreadEvent &ev);
 
 	void ScrollAxis(Axis *axis, int d);
 
 	Chart *m_chart;
 
+	// cached layers, markers layer contains static layer below it,
+	// back buffer is composed from markers, data and overlay layers
+	wxBitmap m_staticBitmap;
+	wxBitmap m_markersBitmap;
+	wxBitmap m_dataBitmap;
 	wxBitmap m_backBitmap;
 
+	// data layer has transparent background, and doesn't contain
+	// markers layer, so markers can be changed without redrawing data
+	bool m_dataTransparent;
+
 	bool m_antialias;
 
+	// redraw scheduling
+	int m_dirtyLayers;
+	int m_maxFps;
+	wxTimer m_redrawTimer;
+	wxLongLong m_lastRedrawTime;
+
+	// background rendering
+	bool m_asyncRendering;
+	ChartRenderThread *m_renderThread;
+	int m_renderId;
+	int m_renderLayers; // layers drawn by worker thread
+
+	/**
+	 * Axis scroll, deferred until worker thread stops.
+	 */
+	struct PendingScroll
+	{
+		Axis *axis;
+		double winPos;
+	};
+
+	std::vector<PendingScroll> m_pendingScrolls;
+
+	// progressive rendering
+	bool m_progressiveRendering;
+	size_t m_coarseSampleLimit;
+	bool m_refinePending;
+
 	ChartPanelMode *m_mode;
 
 	DECLARE_EVENT_TABLE()
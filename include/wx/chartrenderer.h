@@ -15,6 +15,30 @@
 #include <wx/refobject.h>
 #include <wx/art.h>
 
+#include <vector>
+
+class WXDLLIMPEXP_FREECHART AreaDraw;
+
+/**
+ * Serie drawing style, resolved by renderer from its settings.
+ * Pens and brushes are reference counted, so copies are cheap
+ * and share the same native objects.
+ */
+struct WXDLLIMPEXP_FREECHART SerieStyle
+{
+	SerieStyle()
+	{
+		symbol = NULL;
+		areaDraw = NULL;
+	}
+
+	wxColour colour;
+	wxPen pen;
+	wxBrush brush;
+	Symbol *symbol;
+	AreaDraw *areaDraw;
+};
+
 /**
  * Base class for all renderers.
  */
@@ -60,9 +84,57 @@ public:
 	 */
 	virtual void DrawLegendSymbol(wxDC &dc, wxRect rcSymbol, size_t serie);
 
+	/**
+	 * Returns resolved drawing style for serie. Styles are resolved
+	 * once and kept until renderer is changed, so it's cheap to call
+	 * from drawing loops.
+	 * @param serie serie index
+	 * @return serie style
+	 */
+	const SerieStyle &GetSerieStyle(size_t serie)
+	{
+		if (serie >= m_serieStyles.size()) {
+			ResolveSerieStyles(serie + 1);
+		}
+		return m_serieStyles[serie];
+	}
+
+protected:
+	/**
+	 * Resolves drawing style for serie.
+	 * Default implementation sets serie colour and symbol, and solid
+	 * pen and brush of serie colour. Derivative classes override it
+	 * to set their own pens, brushes and area draws.
+	 * @param serie serie index
+	 * @param style output style
+	 */
+	virtual void ResolveSerieStyle(size_t serie, SerieStyle &style);
+
+	/**
+	 * Drops resolved serie styles. Called when renderer is changed.
+	 */
+	void InvalidateSerieStyles()
+	{
+		m_serieStyles.clear();
+	}
+
+	/**
+	 * Drops resolved serie styles, and notifies observers, that
+	 * renderer needs to be redrawn.
+	 */
+	void FireNeedRedraw()
+	{
+		InvalidateSerieStyles();
+		DrawObject::FireNeedRedraw();
+	}
+
 private:
+	void ResolveSerieStyles(size_t count);
+
 	ColorMap m_serieColours;
 	SymbolMap m_serieSymbols;
+
+	std::vector<SerieStyle> m_serieStyles;
 };
 
 #endif /*RENDERER_H_*/
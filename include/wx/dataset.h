@@ -41,6 +41,21 @@ public:
 	virtual ~DatasetObserver();
 
 	virtual void DatasetChanged(Dataset *dataset) = 0;
+
+	/**
+	 * Called when some of dataset markers has been changed, while
+	 * dataset data is not changed.
+	 * Default implementation calls DatasetChanged.
+	 * @param dataset dataset
+	 */
+	virtual void DatasetMarkersChanged(Dataset *dataset);
+
+	/**
+	 * Called when dataset renderer has been changed or replaced.
+	 * Default implementation calls DatasetChanged.
+	 * @param dataset dataset
+	 */
+	virtual void DatasetRendererChanged(Dataset *dataset);
 };
 
 /**
@@ -77,6 +92,29 @@ public:
 	 */
 	void EndUpdate();
 
+	/**
+	 * Checks whether data was only appended to series since previous
+	 * change notification, and existing data wasn't changed.
+	 * Can be called by observers from DatasetChanged.
+	 * @return true if data was only appended
+	 */
+	bool IsAppendOnlyChange()
+	{
+		return m_appendOnly;
+	}
+
+	/**
+	 * Returns counter of dataset modifications, other than appending data.
+	 * Used by objects, that cache values calculated from data, and don't
+	 * receive change notifications (eg. renderers), to find whether
+	 * cached data can be updated only with appended data.
+	 * @return modification counter
+	 */
+	size_t GetModificationCount()
+	{
+		return m_modificationCount;
+	}
+
 	/**
 	 * Returns serie count in this dataset.
 	 * @return serie count
@@ -151,14 +189,39 @@ protected:
 	 */
 	void DatasetChanged();
 
+	/**
+	 * Called to indicate, that data was only appended to series, and
+	 * existing data isn't changed. Strip charts and renderers then
+	 * can draw only appended data.
+	 * For call by derivate classes.
+	 */
+	void DatasetAppended();
+
+	/**
+	 * Called when dataset data is changed, before observers are notified.
+	 * Derivative classes, that caches values calculated from data,
+	 * must override it to drop caches.
+	 */
+	virtual void InvalidateCaches();
+
 	Renderer *m_renderer;
 private:
+	void NotifyChanged();
+
+	void NotifyRendererChanged();
+
 	bool m_updating;
 	bool m_changed;
+	bool m_rendererChanged;
+	bool m_markersChanged;
+	bool m_appendOnly; // data was only appended since last notification
+	size_t m_modificationCount;
 
 	MarkerArray m_markers;
 
 	FIRE_WITH_THIS(DatasetChanged);
+	FIRE_WITH_THIS(DatasetMarkersChanged);
+	FIRE_WITH_THIS(DatasetRendererChanged);
 };
 
 /**
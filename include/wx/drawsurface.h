@@ -0,0 +1,253 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	drawsurface.h
+// Purpose: drawing surface declarations
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef DRAWSURFACE_H_
+#define DRAWSURFACE_H_
+
+#include <wx/wxfreechartdefs.h>
+#include <wx/canceltoken.h>
+
+#if wxUSE_GRAPHICS_CONTEXT
+#include <wx/graphics.h>
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+class Symbol;
+
+/**
+ * Drawing surface, used by renderers to draw data.
+ * Hides drawing backend from renderers: drawing can be performed
+ * directly to device context, or to memory buffer, that is drawn
+ * to device context at once.
+ */
+class WXDLLIMPEXP_FREECHART DrawSurface
+{
+public:
+	DrawSurface();
+	virtual ~DrawSurface();
+
+	/**
+	 * Returns device context, where surface is drawn.
+	 * It can be used for coordinate transformations and text measurement.
+	 * Drawing directly to it is allowed only after Flush call.
+	 * @return device context
+	 */
+	virtual wxDC &GetDC() = 0;
+
+	/**
+	 * Checks whether surface draws antialiased.
+	 * @return true if surface draws antialiased
+	 */
+	virtual bool IsAntialiased() = 0;
+
+	/**
+	 * Draws buffered drawings to device context, so it can be used
+	 * to draw directly.
+	 */
+	virtual void Flush() = 0;
+
+	/**
+	 * Sets pen to draw lines and outlines.
+	 * @param pen pen
+	 */
+	virtual void SetPen(const wxPen &pen) = 0;
+
+	/**
+	 * Sets brush to fill rectangles.
+	 * @param brush brush
+	 */
+	virtual void SetBrush(const wxBrush &brush) = 0;
+
+	/**
+	 * Draws line.
+	 * @param x0 x coordinate of first point
+	 * @param y0 y coordinate of first point
+	 * @param x1 x coordinate of second point
+	 * @param y1 y coordinate of second point
+	 */
+	virtual void DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1) = 0;
+
+	/**
+	 * Draws polyline.
+	 * @param count point count
+	 * @param points points
+	 */
+	virtual void DrawLines(size_t count, const wxPoint *points) = 0;
+
+	/**
+	 * Draws rectangle with current pen and brush.
+	 * @param x x coordinate of left top corner
+	 * @param y y coordinate of left top corner
+	 * @param width rectangle width
+	 * @param height rectangle height
+	 */
+	virtual void DrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height) = 0;
+
+	/**
+	 * Draws rectangle with current pen and brush.
+	 * @param rc rectangle
+	 */
+	void DrawRectangle(const wxRect &rc)
+	{
+		DrawRectangle(rc.x, rc.y, rc.width, rc.height);
+	}
+
+	/**
+	 * Draws symbols at points.
+	 * @param symbol symbol to draw
+	 * @param points symbol centers
+	 * @param count point count
+	 * @param color symbol color
+	 */
+	virtual void DrawSymbols(Symbol *symbol, const wxPoint *points, size_t count, wxColour color) = 0;
+
+	/**
+	 * Sets token, used to cancel drawing.
+	 * @param cancel cancellation token, or NULL if drawing can't be cancelled
+	 */
+	void SetCancelToken(CancelToken *cancel)
+	{
+		m_cancel = cancel;
+	}
+
+	/**
+	 * Checks whether drawing is cancelled. Renderers must check it
+	 * from time to time, and stop drawing if it's cancelled.
+	 * @return true if drawing is cancelled
+	 */
+	bool IsCancelled()
+	{
+		return m_cancel != NULL && m_cancel->IsCancelled();
+	}
+
+	/**
+	 * Sets maximal count of points per serie to draw. It's used to draw
+	 * coarse preview of large datasets quickly.
+	 * @param sampleLimit maximal point count, or 0 to draw all points
+	 */
+	void SetSampleLimit(size_t sampleLimit)
+	{
+		m_sampleLimit = sampleLimit;
+	}
+
+	/**
+	 * Returns maximal count of points per serie to draw.
+	 * @return maximal point count, or 0 if all points are drawn
+	 */
+	size_t GetSampleLimit()
+	{
+		return m_sampleLimit;
+	}
+
+	/**
+	 * Returns step between indices of points, that renderers draw
+	 * for serie, so point count doesn't exceed sample limit.
+	 * @param count serie point count
+	 * @return step between drawn points
+	 */
+	size_t GetSampleStride(size_t count)
+	{
+		if (m_sampleLimit == 0 || count <= m_sampleLimit) {
+			return 1;
+		}
+		m_sampled = true;
+		return (count + m_sampleLimit - 1) / m_sampleLimit;
+	}
+
+	/**
+	 * Checks whether some serie was drawn with step greater than one,
+	 * so drawing is coarse preview and must be refined later.
+	 * @return true if some points were skipped
+	 */
+	bool IsSampled()
+	{
+		return m_sampled;
+	}
+
+private:
+	CancelToken *m_cancel;
+	size_t m_sampleLimit;
+	bool m_sampled;
+};
+
+/**
+ * Drawing surface, that draws directly to device context.
+ * When device context is graphics context based (antialiased),
+ * connected lines, drawn with the same pen, are collected to one
+ * graphics path, and stroked at once, because stroking of each
+ * line separately is very slow.
+ */
+class WXDLLIMPEXP_FREECHART DCDrawSurface : public DrawSurface
+{
+public:
+	/**
+	 * Constructs new surface.
+	 * @param dc device context to draw to
+	 */
+	DCDrawSurface(wxDC &dc);
+	virtual ~DCDrawSurface();
+
+	virtual wxDC &GetDC();
+
+	virtual bool IsAntialiased();
+
+	virtual void Flush();
+
+	virtual void SetPen(const wxPen &pen);
+
+	virtual void SetBrush(const wxBrush &brush);
+
+	virtual void DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1);
+
+	virtual void DrawLines(size_t count, const wxPoint *points);
+
+	virtual void DrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height);
+
+	virtual void DrawSymbols(Symbol *symbol, const wxPoint *points, size_t count, wxColour color);
+
+private:
+	void FlushPath();
+
+	wxDC &m_dc;
+
+#if wxUSE_GRAPHICS_CONTEXT
+	wxGraphicsContext *m_gc;
+
+	// lines, that are not stroked yet
+	wxGraphicsPath m_path;
+	size_t m_pathLines;
+	wxPoint m_pathEnd;
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+};
+
+/**
+ * Checks whether device context draws antialiased (it's graphics
+ * context based).
+ * @param dc device context
+ * @return true if device context draws antialiased
+ */
+WXDLLIMPEXP_FREECHART bool IsAntialiasedDC(wxDC &dc);
+
+/**
+ * Checks whether called from main thread. Bitmaps, memory device contexts
+ * and symbol sprites can be used from main thread only.
+ * @return true if called from main thread, or threads are not supported
+ */
+WXDLLIMPEXP_FREECHART bool IsMainThread();
+
+/**
+ * Creates font with the same attributes, that doesn't share data with
+ * original. wxWidgets objects share data with reference counter, that
+ * isn't thread safe, so charts must not keep copies of stock fonts,
+ * when they are drawn from different threads at once.
+ * @param font font to copy
+ * @return new font
+ */
+WXDLLIMPEXP_FREECHART wxFont CopyFont(const wxFont &font);
+
+#endif /*DRAWSURFACE_H_*/
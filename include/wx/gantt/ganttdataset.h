@@ -13,6 +13,8 @@
 //#include <wx/dataset.h>
 #include <wx/category/categorydataset.h>
 
+#include <vector>
+
 class GanttRenderer;
 class GanttDataset;
 
@@ -34,6 +36,68 @@ private:
 	GanttDataset *m_ganttDataset;
 };
 
+/**
+ * Interval index for tasks of one gantt serie.
+ * Tasks are sorted by start time and organized into implicit
+ * augmented binary tree, so tasks intersecting time range can be found
+ * in O(log(n) + k) time, where k is number of found tasks.
+ * Internal class, don't use from programs.
+ */
+class WXDLLIMPEXP_FREECHART GanttTaskIndex
+{
+public:
+	GanttTaskIndex();
+	virtual ~GanttTaskIndex();
+
+	/**
+	 * Builds index for tasks of specified serie.
+	 * @param dataset gantt dataset
+	 * @param serie serie index
+	 */
+	void Build(GanttDataset *dataset, size_t serie);
+
+	/**
+	 * Clears index.
+	 */
+	void Clear();
+
+	/**
+	 * Checks whether index is built.
+	 * @return true if index is built
+	 */
+	bool IsBuilt()
+	{
+		return m_built;
+	}
+
+	/**
+	 * Finds tasks, that intersects time range [start, end].
+	 * Indexes of found tasks are appended to tasks array.
+	 * @param start time range start
+	 * @param end time range end
+	 * @param tasks array to append task indexes to
+	 */
+	void Find(time_t start, time_t end, std::vector<size_t> &tasks);
+
+private:
+	struct TaskInterval
+	{
+		time_t start;
+		time_t end;
+		time_t maxEnd; // maximal end in subtree
+		size_t index;
+
+		bool operator < (const TaskInterval &other) const
+		{
+			return start < other.start;
+		}
+	};
+
+	std::vector<TaskInterval> m_intervals;
+	int m_maxLevel;
+	bool m_built;
+};
+
 /**
  * Gantt chart dataset base class.
  */
@@ -80,10 +144,31 @@ public:
 	 */
 	virtual size_t GetCount(size_t serie);
 
+	/**
+	 * Returns minimal task start time.
+	 * Value is cached until dataset is changed.
+	 * @return minimal task start time
+	 */
 	virtual time_t GetMinStart();
 
+	/**
+	 * Returns maximal task end time.
+	 * Value is cached until dataset is changed.
+	 * @return maximal task end time
+	 */
 	virtual time_t GetMaxEnd();
 
+	/**
+	 * Finds tasks in specified serie, that intersects time range [start, end].
+	 * Uses interval index, that is built on first call and
+	 * dropped when dataset is changed.
+	 * @param serie serie index
+	 * @param start time range start
+	 * @param end time range end
+	 * @param tasks array to append found task indexes to
+	 */
+	void FindTasks(size_t serie, time_t start, time_t end, std::vector<size_t> &tasks);
+
 	time_t GetDateInterval();
 
 	size_t GetDateCount();
@@ -93,10 +178,23 @@ public:
 		return (GanttRenderer *) m_renderer;
 	}
 
+protected:
+	virtual void InvalidateCaches();
+
 private:
+	void UpdateExtents();
+
 	GanttDatasetDateHelper m_dateHelper;
 
 	size_t m_dateCount;
+
+	// cached task time extents
+	bool m_extentsValid;
+	time_t m_minStart;
+	time_t m_maxEnd;
+
+	// interval indexes for series, built on demand
+	std::vector<GanttTaskIndex> m_taskIndexes;
 };
 
 #endif /* GANTTDATASET_H_ */
@@ -61,6 +61,9 @@ public:
 		}
 	}
 
+protected:
+	virtual void ResolveSerieStyle(size_t serie, SerieStyle &style);
+
 private:
 
 	int m_barWidth;
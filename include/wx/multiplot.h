@@ -49,11 +49,15 @@ public:
 	//
 	virtual void PlotNeedRedraw(Plot *plot);
 
+	virtual void PlotLayersNeedRedraw(Plot *plot, int layers);
+
 protected:
 	virtual bool HasData();
 
 	virtual void DrawData(wxDC &dc, wxRect rc);
 
+	virtual void DrawDataLayers(wxDC &dc, wxRect rc, int layers);
+
 private:
 	PlotArray m_subPlots;
 
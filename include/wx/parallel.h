@@ -0,0 +1,55 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	parallel.h
+// Purpose: parallel processing utilities declarations
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef PARALLEL_H_
+#define PARALLEL_H_
+
+#include <wx/wxfreechartdefs.h>
+
+/**
+ * Task, that can be split into independent parts, and
+ * processed in several threads.
+ * Run is called from worker threads, so it must not use GUI, and
+ * must write only to data owned by worker.
+ */
+class WXDLLIMPEXP_FREECHART ParallelTask
+{
+public:
+	ParallelTask();
+	virtual ~ParallelTask();
+
+	/**
+	 * Processes part of items.
+	 * @param first index of first item to process
+	 * @param last index after last item to process
+	 * @param worker worker index, from 0 to GetParallelWorkerCount() - 1
+	 */
+	virtual void Run(size_t first, size_t last, size_t worker) = 0;
+};
+
+/**
+ * Returns maximal count of workers, used by ParallelFor.
+ * It's equal to CPU count, or 1 if threads are not supported.
+ * @return worker count
+ */
+WXDLLIMPEXP_FREECHART size_t GetParallelWorkerCount();
+
+/**
+ * Splits items range [0, count) to parts, and processes them by task
+ * in worker threads. One part is processed in calling thread.
+ * Returns when all parts are processed.
+ * @param task task to process items
+ * @param count item count
+ * @param minItemsPerWorker minimal items count to process by one worker,
+ * small ranges are processed in calling thread
+ * @return count of workers used
+ */
+WXDLLIMPEXP_FREECHART size_t ParallelFor(ParallelTask &task, size_t count, size_t minItemsPerWorker = 4096);
+
+#endif /*PARALLEL_H_*/
@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	pixeloccupancy.h
+// Purpose: pixel occupancy bitmap declaration
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef PIXELOCCUPANCY_H_
+#define PIXELOCCUPANCY_H_
+
+#include <wx/wxfreechartdefs.h>
+
+#include <vector>
+
+/**
+ * Occupancy bitmap, used by renderers to skip drawing of objects
+ * (symbols, bubbles), that are identical to already drawn ones, at the
+ * same pixel. Each pixel has 8 bits, so up to 8 object variants
+ * (eg. radiuses) can be tracked per pixel.
+ * Skipping is invisible only if all tracked objects are drawn with the
+ * same colour, so result doesn't depend on drawing order.
+ */
+class WXDLLIMPEXP_FREECHART PixelOccupancy
+{
+public:
+	/**
+	 * Maximal count of object variants per pixel.
+	 */
+	static const size_t maxVariants = 8;
+
+	PixelOccupancy();
+	virtual ~PixelOccupancy();
+
+	/**
+	 * Clears all pixels. Called before each serie drawing.
+	 * Memory is allocated and cleared lazily on first Occupy call.
+	 * @param rc area, which pixels are tracked
+	 */
+	void Reset(wxRect rc);
+
+	/**
+	 * Marks pixel as occupied by object variant.
+	 * @param x x coordinate
+	 * @param y y coordinate
+	 * @param variant object variant, from 0 to maxVariants - 1
+	 * @return false if pixel is already occupied by this variant, and
+	 * object can be skipped, true if object must be drawn, including
+	 * case when pixel or variant is out of tracked range
+	 */
+	bool Occupy(wxCoord x, wxCoord y, size_t variant = 0)
+	{
+		if (x < m_rc.x || x >= m_rc.x + m_rc.width || y < m_rc.y || y >= m_rc.y + m_rc.height ||
+				variant >= maxVariants) {
+			return true;
+		}
+
+		if (!m_cleared) {
+			m_bits.assign(m_rc.width * m_rc.height, 0);
+			m_cleared = true;
+		}
+
+		unsigned char &bits = m_bits[(y - m_rc.y) * m_rc.width + (x - m_rc.x)];
+		unsigned char variantBit = (unsigned char) (1 << variant);
+
+		if (bits & variantBit) {
+			m_culledCount++;
+			return false;
+		}
+		bits |= variantBit;
+		return true;
+	}
+
+	/**
+	 * Returns count of objects skipped since ResetCulledCount call.
+	 * @return skipped objects count
+	 */
+	size_t GetCulledCount()
+	{
+		return m_culledCount;
+	}
+
+	/**
+	 * Resets skipped objects count.
+	 */
+	void ResetCulledCount()
+	{
+		m_culledCount = 0;
+	}
+
+private:
+	wxRect m_rc;
+	bool m_cleared;
+	std::vector<unsigned char> m_bits;
+
+	size_t m_culledCount;
+};
+
+#endif /*PIXELOCCUPANCY_H_*/
@@ -14,10 +14,36 @@
 #include <wx/observable.h>
 
 #include <wx/areadraw.h>
+#include <wx/canceltoken.h>
 
 class WXDLLIMPEXP_FREECHART Plot;
 class WXDLLIMPEXP_FREECHART wxChartPanel;
 
+/**
+ * Chart drawing layers. Layers are drawn one over another, chart panel
+ * caches them separately, and redraws only changed layers and layers above.
+ */
+enum CHART_LAYER {
+	/**
+	 * Backgrounds, titles and axes.
+	 */
+	CHART_LAYER_STATIC = 1,
+	/**
+	 * Markers and grid lines, drawn under data.
+	 */
+	CHART_LAYER_MARKERS = 2,
+	/**
+	 * Datasets.
+	 */
+	CHART_LAYER_DATA = 4,
+	/**
+	 * Legend and crosshair, drawn over data.
+	 */
+	CHART_LAYER_OVERLAY = 8,
+
+	CHART_LAYER_ALL = CHART_LAYER_STATIC | CHART_LAYER_MARKERS | CHART_LAYER_DATA | CHART_LAYER_OVERLAY
+};
+
 /**
  * Interface that receives Plot events, such as need redraw condition.
  */
@@ -33,6 +59,14 @@ public:
 	 * @param _plot plot
 	 */
 	virtual void PlotNeedRedraw(Plot *_plot) = 0;
+
+	/**
+	 * Called when some of plot layers has been changed and need to be redrawn.
+	 * Default implementation calls PlotNeedRedraw.
+	 * @param _plot plot
+	 * @param layers changed layers, combination of CHART_LAYER values
+	 */
+	virtual void PlotLayersNeedRedraw(Plot *_plot, int layers);
 };
 
 /**
@@ -52,6 +86,19 @@ public:
 	 */
 	virtual void Draw(wxDC &dc, wxRect rc);
 
+	/**
+	 * Draws plot layers.
+	 * @param dc device context
+	 * @param rc rectangle where to draw
+	 * @param layers layers to draw, combination of CHART_LAYER values
+	 * @param cancel token to cancel drawing, or NULL
+	 * @param sampleLimit maximal count of points per serie to draw coarse
+	 * preview, or 0 to draw all points
+	 * @return true if some serie was drawn coarse, because it has more
+	 * points than sampleLimit
+	 */
+	bool DrawLayers(wxDC &dc, wxRect rc, int layers, CancelToken *cancel = NULL, size_t sampleLimit = 0);
+
 	/**
 	 * Draws "no data" message.
 	 * Can be overriden by derivative classes.
@@ -105,6 +152,16 @@ protected:
 	 */
 	virtual void DrawData(wxDC &dc, wxRect rc) = 0;
 
+	/**
+	 * Perform data rendering of specified layers.
+	 * Default implementation draws all data with static layer,
+	 * derivative classes can override it to support layers.
+	 * @param dc device context
+	 * @param rc rectangle where to draw
+	 * @param layers layers to draw, combination of CHART_LAYER values
+	 */
+	virtual void DrawDataLayers(wxDC &dc, wxRect rc, int layers);
+
 	/**
 	 * Called when chart panel is changed.
 	 * @param oldPanel old chart panel
@@ -112,9 +169,55 @@ protected:
 	 */
 	virtual void ChartPanelChanged(wxChartPanel *oldPanel, wxChartPanel *newPanel);
 
+	/**
+	 * Returns token to cancel drawing, passed to DrawLayers.
+	 * Valid only while plot is drawn.
+	 * @return cancellation token, or NULL if drawing can't be cancelled
+	 */
+	CancelToken *GetCancelToken()
+	{
+		return m_cancel;
+	}
+
+	/**
+	 * Checks whether drawing is cancelled. Derivative classes must
+	 * check it between drawing of long parts, and stop drawing
+	 * if it's cancelled.
+	 * @return true if drawing is cancelled
+	 */
+	bool IsDrawCancelled()
+	{
+		return m_cancel != NULL && m_cancel->IsCancelled();
+	}
+
+	/**
+	 * Returns maximal count of points per serie to draw, passed
+	 * to DrawLayers. Valid only while plot is drawn.
+	 * @return maximal point count, or 0 if all points must be drawn
+	 */
+	size_t GetSampleLimit()
+	{
+		return m_sampleLimit;
+	}
+
+	/**
+	 * Marks, that some serie was drawn coarse, and must be refined.
+	 * Called by derivative classes when drawing surface reports skipped points.
+	 */
+	void SetSampled()
+	{
+		m_sampled = true;
+	}
+
 	FIRE_WITH_THIS(PlotNeedRedraw);
 
+	void FirePlotLayersNeedRedraw(int layers);
+
 private:
+	CancelToken *m_cancel;
+	size_t m_sampleLimit;
+	bool m_sampled;
+
 	wxFont m_textNoDataFont;
 	wxString m_textNoData;
 
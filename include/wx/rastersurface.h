@@ -0,0 +1,180 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	rastersurface.h
+// Purpose: memory buffer drawing surface declarations
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef RASTERSURFACE_H_
+#define RASTERSURFACE_H_
+
+#include <wx/drawsurface.h>
+
+#include <vector>
+
+/**
+ * Drawing surface, that rasterizes lines, rectangles and symbols
+ * directly into memory buffer of RGBA pixels, and draws buffer to
+ * device context at once on Flush.
+ * It's much faster than device context for large count of primitives,
+ * especially when antialiasing is used.
+ * Limitations: lines are drawn with solid pen style and butt caps,
+ * rectangle outlines are 1 pixel wide.
+ *
+ * Drawing doesn't use GUI, so surface can be drawn from worker thread,
+ * except symbols: symbol sprites must be created in main thread
+ * before (see Symbol::GetSpriteImage). In other threads symbols are
+ * drawn directly to device context.
+ * Buffer can be drawn on Flush in other thread than main, only
+ * to graphics context based device context (see CanDrawTo).
+ */
+class WXDLLIMPEXP_FREECHART RasterDrawSurface : public DrawSurface
+{
+public:
+	/**
+	 * Constructs new surface.
+	 * @param dc device context, where buffer will be drawn on Flush
+	 * @param rc rectangle covered by buffer, drawing outside it is clipped
+	 * @param antialias true to draw antialiased lines and symbols
+	 */
+	RasterDrawSurface(wxDC &dc, wxRect rc, bool antialias);
+	virtual ~RasterDrawSurface();
+
+	virtual wxDC &GetDC();
+
+	virtual bool IsAntialiased();
+
+	virtual void Flush();
+
+	virtual void SetPen(const wxPen &pen);
+
+	virtual void SetBrush(const wxBrush &brush);
+
+	virtual void DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1);
+
+	virtual void DrawLines(size_t count, const wxPoint *points);
+
+	virtual void DrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height);
+
+	virtual void DrawSymbols(Symbol *symbol, const wxPoint *points, size_t count, wxColour color);
+
+	/**
+	 * Checks whether buffer can be drawn to device context from
+	 * current thread. Bitmaps can be used only in main thread,
+	 * graphics bitmaps can be used in any thread. Also buffer
+	 * pixels must correspond to device pixels.
+	 * @param dc device context
+	 * @return true if surface can be used to draw to device context
+	 */
+	static bool CanDrawTo(wxDC &dc);
+
+	/**
+	 * Sets clipping rectangle. Drawing is clipped by intersection of
+	 * clipping rectangle and buffer rectangle.
+	 * @param rcClip clipping rectangle
+	 */
+	void SetClippingRect(wxRect rcClip);
+
+	/**
+	 * Returns rectangle, covered by buffer.
+	 * @return buffer rectangle
+	 */
+	const wxRect &GetRect()
+	{
+		return m_rc;
+	}
+
+	/**
+	 * Returns buffer pixels. Pixels are stored by rows, each pixel is
+	 * 0xAARRGGBB value with color components premultiplied by alpha.
+	 * @return buffer pixels
+	 */
+	wxUint32 *GetPixels()
+	{
+		return (m_pixels.size() != 0) ? &m_pixels[0] : NULL;
+	}
+
+	/**
+	 * Clears buffer to transparent.
+	 */
+	void Clear();
+
+	/**
+	 * Converts buffer to image with alpha channel.
+	 * @return image
+	 */
+	wxImage ToImage();
+
+	/**
+	 * Sets pen in buffer pixel format. Unlike SetPen, can be called
+	 * from worker thread.
+	 * @param visible false if pen is transparent
+	 * @param color pen color pixel (see ColourToPixel)
+	 * @param width pen width
+	 */
+	void SetRasterPen(bool visible, wxUint32 color, double width);
+
+	/**
+	 * Sets brush in buffer pixel format. Unlike SetBrush, can be called
+	 * from worker thread.
+	 * @param visible false if brush is transparent
+	 * @param color brush color pixel (see ColourToPixel)
+	 */
+	void SetRasterBrush(bool visible, wxUint32 color);
+
+	/**
+	 * Draws sprite at points. Unlike DrawSymbols, can be called
+	 * from worker thread.
+	 * @param pixels sprite pixels in buffer pixel format
+	 * @param width sprite width
+	 * @param height sprite height
+	 * @param center sprite center
+	 * @param points sprite centers
+	 * @param count point count
+	 */
+	void DrawSprite(const wxUint32 *pixels, wxCoord width, wxCoord height, wxPoint center, const wxPoint *points, size_t count);
+
+	/**
+	 * Converts color to buffer pixel format.
+	 * @param color color
+	 * @return pixel
+	 */
+	static wxUint32 ColourToPixel(const wxColour &color);
+
+	/**
+	 * Converts image to buffer pixel format.
+	 * @param image image
+	 * @param pixels output for pixels
+	 */
+	static void ImageToPixels(const wxImage &image, std::vector<wxUint32> &pixels);
+
+private:
+	void BlendPixel(wxCoord x, wxCoord y, wxUint32 color, unsigned int coverage);
+
+	void FillSpan(wxCoord y, wxCoord x0, wxCoord x1, wxUint32 color);
+
+	void RasterLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1, bool drawLast);
+
+	wxDC &m_dc;
+	wxRect m_rc;
+	wxRect m_rcClip;
+	bool m_antialias;
+
+	std::vector<wxUint32> m_pixels;
+	bool m_dirty;
+
+	// current pen and brush
+	wxUint32 m_penColor;
+	double m_penWidth;
+	bool m_penVisible;
+
+	wxUint32 m_brushColor;
+	bool m_brushVisible;
+
+	// last used sprite, converted to buffer pixel format
+	std::vector<wxUint32> m_spritePixels;
+};
+
+#endif /*RASTERSURFACE_H_*/
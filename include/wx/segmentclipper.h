@@ -0,0 +1,86 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	segmentclipper.h
+// Purpose: line segments clipper declaration
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef SEGMENTCLIPPER_H_
+#define SEGMENTCLIPPER_H_
+
+#include <wx/wxfreechartdefs.h>
+#include <wx/axis/axis.h>
+
+#include <vector>
+
+/**
+ * Clips polylines by visible area of axes, used by line and area renderers.
+ * Points are transformed to graphics space at once, then segments
+ * are clipped by rectangle, where visible values are mapped.
+ * Outcodes of all points are calculated in one pass, so segments, that are
+ * entirely inside or on one side of rectangle, are accepted or rejected
+ * without more work (Cohen-Sutherland), and other segments are clipped
+ * with Liang-Barsky algorithm.
+ * Areas under polylines are clipped as polygons: segments are cut only
+ * by left and right edges, and parts above or below rectangle are
+ * clamped to its top or bottom edge.
+ */
+class WXDLLIMPEXP_FREECHART SegmentClipper
+{
+public:
+	/**
+	 * Constructs new clipper.
+	 * @param horizTransform transform of horizontal axis
+	 * @param vertTransform transform of vertical axis
+	 */
+	SegmentClipper(const AxisTransform &horizTransform, const AxisTransform &vertTransform);
+	virtual ~SegmentClipper();
+
+	/**
+	 * Clips polyline, and appends its visible segments to array,
+	 * in graphics coordinates. Each segment is pair of points, visible
+	 * connected segments share end points.
+	 * @param xValues x coordinates of polyline points in data space
+	 * @param yValues y coordinates of polyline points in data space
+	 * @param count point count
+	 * @param segments array to append segments
+	 */
+	void ClipPolyline(const double *xValues, const double *yValues, size_t count, std::vector<wxPoint> &segments);
+
+	/**
+	 * Clips area under polyline, and appends its segments to array,
+	 * in graphics coordinates, like ClipPolyline does. Segments out of
+	 * rectangle by left or right side are skipped, segments out of it
+	 * by top or bottom are clamped to edge, so area stays filled there.
+	 * @param xValues x coordinates of polyline points in data space
+	 * @param yValues y coordinates of polyline points in data space
+	 * @param count point count
+	 * @param segments array to append segments
+	 */
+	void ClipArea(const double *xValues, const double *yValues, size_t count, std::vector<wxPoint> &segments);
+
+private:
+	void CalcCodes(const double *xValues, const double *yValues, size_t count);
+
+	bool ClipSegment(double &x0, double &y0, double &x1, double &y1, bool clipVert);
+
+	void AddClampedSegment(double x0, double y0, double x1, double y1, std::vector<wxPoint> &segments);
+
+	AxisTransform m_horizTransform;
+	AxisTransform m_vertTransform;
+
+	// clipping rectangle
+	double m_xMin;
+	double m_xMax;
+	double m_yMin;
+	double m_yMax;
+
+	// graphics coordinates and outcodes of points
+	std::vector<double> m_xCoords;
+	std::vector<double> m_yCoords;
+	std::vector<unsigned char> m_codes;
+};
+
+#endif /*SEGMENTCLIPPER_H_*/
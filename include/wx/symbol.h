@@ -12,8 +12,17 @@
 
 #include <wx/wxfreechartdefs.h>
 
+#include <vector>
+
+#if wxUSE_GRAPHICS_CONTEXT
+#include <wx/graphics.h>
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
 /**
  * Symbols base class.
+ * To draw many symbols fast, symbol is prerendered to bitmap (sprite)
+ * for each colour, and then sprite is copied to each point.
+ * Sprites are cached by colour, size and antialiasing.
  */
 class WXDLLIMPEXP_FREECHART Symbol
 {
@@ -22,7 +31,9 @@ public:
 	virtual ~Symbol();
 
 	/**
-	 * Performs symbol drawing.
+	 * Performs symbol drawing. Symbol must be drawn directly to device
+	 * context: DrawSymbols calls this method for each point, when it's
+	 * called from worker thread, so it must not call DrawSymbols.
 	 * @param dc device context
 	 * @param x x coordinate
 	 * @param y y coordinate
@@ -30,11 +41,83 @@ public:
 	 */
 	virtual void Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color) = 0;
 
+	/**
+	 * Draws symbol at several points. Uses cached sprite for colour, so
+	 * symbol itself is drawn only once. For graphics context based device
+	 * contexts symbols are drawn as one graphics path, if symbol supports
+	 * it (see AddToPath).
+	 * @param dc device context
+	 * @param points symbol centers
+	 * @param count point count
+	 * @param color color to draw symbol
+	 */
+	virtual void DrawSymbols(wxDC &dc, const wxPoint *points, size_t count, wxColour color);
+
+#if wxUSE_GRAPHICS_CONTEXT
+	/**
+	 * Adds symbol shape to graphics path. Path is stroked with pen and
+	 * filled with brush of symbol color, so symbols at many points are
+	 * drawn to graphics context at once.
+	 * Default implementation returns false, then sprites are used.
+	 * @param path graphics path
+	 * @param x x coordinate
+	 * @param y y coordinate
+	 * @return true if symbol shape is added to path
+	 */
+	virtual bool AddToPath(wxGraphicsPath &path, wxCoord x, wxCoord y);
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
 	/**
 	 * Called to calculate size required for symbol.
 	 * @return size required for symbol
 	 */
 	virtual wxSize GetExtent() = 0;
+
+	/**
+	 * Returns cached symbol sprite as image with alpha channel.
+	 * Used to draw symbols to memory buffers.
+	 * @param color color to draw symbol
+	 * @param antialias true to get antialiased sprite
+	 * @param center output symbol center in sprite
+	 * @return sprite image
+	 */
+	const wxImage &GetSpriteImage(wxColour color, bool antialias, wxPoint &center);
+
+protected:
+	/**
+	 * Creates sprite bitmap for symbol.
+	 * Default implementation draws symbol with Draw to bitmap with mask,
+	 * or with alpha channel if antialiasing is used.
+	 * @param color color to draw symbol
+	 * @param antialias true if sprite will be drawn to antialiased device context
+	 * @param center output symbol center in sprite
+	 * @return sprite bitmap
+	 */
+	virtual wxBitmap CreateSprite(wxColour color, bool antialias, wxPoint &center);
+
+	/**
+	 * Drops cached sprites. Must be called, when symbol appearance is changed.
+	 */
+	void ClearSprites();
+
+private:
+	/**
+	 * Cached symbol sprite.
+	 */
+	struct SymbolSprite
+	{
+		wxColour color;
+		wxSize size;
+		bool antialias;
+
+		wxBitmap bitmap;
+		wxImage image;
+		wxPoint center;
+	};
+
+	SymbolSprite &GetSprite(wxColour color, bool antialias);
+
+	std::vector<SymbolSprite> m_sprites;
 };
 
 /**
@@ -52,11 +135,18 @@ public:
 
 	virtual wxSize GetExtent();
 
+protected:
+	virtual wxBitmap CreateSprite(wxColour color, bool antialias, wxPoint &center);
+
 private:
-	wxBitmap m_maskBmp;
-	wxBitmap m_symbolBitmap;
+	/**
+	 * Creates symbol image of given colour, with mask.
+	 * @param color color to draw symbol
+	 * @return symbol image
+	 */
+	wxImage CreateImage(wxColour color);
 
-	bool m_initialized;
+	wxImage m_maskImage;
 
 	wxCoord m_size;
 };
@@ -91,6 +181,10 @@ public:
 	virtual ~CircleSymbol();
 
 	virtual void Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color);
+
+#if wxUSE_GRAPHICS_CONTEXT
+	virtual bool AddToPath(wxGraphicsPath &path, wxCoord x, wxCoord y);
+#endif
 };
 
 /**
@@ -103,6 +197,10 @@ public:
 	virtual ~SquareSymbol();
 
 	virtual void Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color);
+
+#if wxUSE_GRAPHICS_CONTEXT
+	virtual bool AddToPath(wxGraphicsPath &path, wxCoord x, wxCoord y);
+#endif
 };
 
 /**
@@ -115,6 +213,10 @@ public:
 	virtual ~CrossSymbol();
 
 	virtual void Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color);
+
+#if wxUSE_GRAPHICS_CONTEXT
+	virtual bool AddToPath(wxGraphicsPath &path, wxCoord x, wxCoord y);
+#endif
 };
 
 /**
@@ -127,6 +229,13 @@ public:
 	virtual ~TriangleSymbol();
 
 	virtual void Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color);
+
+#if wxUSE_GRAPHICS_CONTEXT
+	virtual bool AddToPath(wxGraphicsPath &path, wxCoord x, wxCoord y);
+#endif
+
+private:
+	void GetPoints(wxCoord x, wxCoord y, wxPoint *pts);
 };
 
 #endif /*SYMBOL_H_*/
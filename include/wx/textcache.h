@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	textcache.h
+// Purpose: text extent cache declaration
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef TEXTCACHE_H_
+#define TEXTCACHE_H_
+
+#include <wx/wxfreechartdefs.h>
+#include <wx/hashmap.h>
+
+#if wxUSE_THREADS
+#include <wx/thread.h>
+#endif /* wxUSE_THREADS */
+
+#include <list>
+
+/**
+ * Cache of text extents, used by layout code (axes, legends, titles),
+ * that measures the same strings on each redraw.
+ * Extents are keyed by font, text, rotation and device context kind,
+ * and least recently used extents are dropped, when cache is full.
+ * One cache is shared by all charts (see TextExtentCache::Get),
+ * and it can be used from any thread.
+ */
+class WXDLLIMPEXP_FREECHART TextExtentCache
+{
+public:
+	/**
+	 * Constructs new cache.
+	 * @param capacity maximal count of cached extents
+	 */
+	TextExtentCache(size_t capacity = 8192);
+	virtual ~TextExtentCache();
+
+	/**
+	 * Returns cache shared by all charts.
+	 * @return shared cache
+	 */
+	static TextExtentCache *Get();
+
+	/**
+	 * Returns extent of single line text, drawn with current font of
+	 * device context.
+	 * @param dc device context
+	 * @param text text
+	 * @param angle text rotation angle in degrees, bounding box of
+	 * rotated text is returned
+	 * @return text extent
+	 */
+	wxSize GetTextExtent(wxDC &dc, const wxString &text, double angle = 0);
+
+	/**
+	 * Returns extent of multiline text, drawn with current font of
+	 * device context.
+	 * @param dc device context
+	 * @param text text
+	 * @return text extent
+	 */
+	wxSize GetMultiLineTextExtent(wxDC &dc, const wxString &text);
+
+	/**
+	 * Sets maximal count of cached extents.
+	 * @param capacity maximal count of cached extents
+	 */
+	void SetCapacity(size_t capacity);
+
+	/**
+	 * Returns maximal count of cached extents.
+	 * @return maximal count of cached extents
+	 */
+	size_t GetCapacity()
+	{
+		return m_capacity;
+	}
+
+	/**
+	 * Drops all cached extents.
+	 */
+	void Clear();
+
+private:
+	wxSize GetExtent(wxDC &dc, const wxString &text, double angle, bool multiLine);
+
+	static wxString GetFontKey(const wxFont &font);
+
+	void Trim();
+
+	struct Entry
+	{
+		wxString key;
+		wxSize extent;
+	};
+
+	typedef std::list<Entry> EntryList;
+
+	WX_DECLARE_STRING_HASH_MAP(EntryList::iterator, EntryMap);
+
+	// entries, most recently used first
+	EntryList m_entries;
+	EntryMap m_index;
+	size_t m_count;
+	size_t m_capacity;
+
+#if wxUSE_THREADS
+	wxCriticalSection m_lock;
+#endif
+};
+
+#endif /*TEXTCACHE_H_*/
@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	tiledsurface.h
+// Purpose: multithreaded tiled drawing surface declarations
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef TILEDSURFACE_H_
+#define TILEDSURFACE_H_
+
+#include <wx/rastersurface.h>
+
+#include <vector>
+
+/**
+ * Drawing surface, that rasterizes drawings in several threads.
+ * Drawings are recorded in calling thread. On Flush surface rectangle
+ * is split to horizontal tiles, and every tile is rasterized by worker
+ * thread to its own buffer, by replaying all recorded drawings in order.
+ * Then tiles are drawn to device context.
+ * Tiles don't overlap, so drawing order is kept without synchronization.
+ * Has the same limitations as RasterDrawSurface.
+ */
+class WXDLLIMPEXP_FREECHART TiledRasterDrawSurface : public DrawSurface
+{
+public:
+	/**
+	 * Constructs new surface.
+	 * @param dc device context, where tiles will be drawn on Flush
+	 * @param rc rectangle covered by surface, drawing outside it is clipped
+	 * @param antialias true to draw antialiased lines and symbols
+	 * @param tileCount count of tiles, 0 to use one tile per worker thread
+	 */
+	TiledRasterDrawSurface(wxDC &dc, wxRect rc, bool antialias, size_t tileCount = 0);
+	virtual ~TiledRasterDrawSurface();
+
+	virtual wxDC &GetDC();
+
+	virtual bool IsAntialiased();
+
+	virtual void Flush();
+
+	virtual void SetPen(const wxPen &pen);
+
+	virtual void SetBrush(const wxBrush &brush);
+
+	virtual void DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1);
+
+	virtual void DrawLines(size_t count, const wxPoint *points);
+
+	virtual void DrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height);
+
+	virtual void DrawSymbols(Symbol *symbol, const wxPoint *points, size_t count, wxColour color);
+
+	/**
+	 * Returns count of tiles.
+	 * @return count of tiles
+	 */
+	size_t GetTileCount()
+	{
+		return m_tiles.size();
+	}
+
+private:
+	friend class TileRasterTask;
+
+	enum CommandType {
+		CMD_PEN,
+		CMD_BRUSH,
+		CMD_LINE,
+		CMD_LINES,
+		CMD_RECTANGLE,
+		CMD_SPRITE
+	};
+
+	/**
+	 * Recorded drawing.
+	 */
+	struct Command
+	{
+		CommandType type;
+		wxCoord x0, y0, x1, y1;
+		wxUint32 color;
+		double width;
+		bool visible;
+		size_t first; // index of first point
+		size_t count; // point count
+		size_t sprite; // sprite index
+	};
+
+	/**
+	 * Symbol sprite, converted to buffer pixel format.
+	 */
+	struct Sprite
+	{
+		Symbol *symbol;
+		wxColour color;
+		std::vector<wxUint32> pixels;
+		wxCoord width;
+		wxCoord height;
+		wxPoint center;
+	};
+
+	Command &AddCommand(CommandType type);
+
+	/**
+	 * Rasterizes all recorded drawings to tile.
+	 * Called from worker threads.
+	 * @param tile tile index
+	 */
+	void RasterTile(size_t tile);
+
+	size_t FindSprite(Symbol *symbol, wxColour color);
+
+	wxDC &m_dc;
+	wxRect m_rc;
+	bool m_antialias;
+
+	std::vector<RasterDrawSurface *> m_tiles;
+
+	std::vector<Command> m_commands;
+	std::vector<wxPoint> m_points;
+	std::vector<Sprite> m_sprites;
+};
+
+#endif /*TILEDSURFACE_H_*/
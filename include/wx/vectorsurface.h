@@ -0,0 +1,87 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	vectorsurface.h
+// Purpose: vector output drawing surface declarations
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef VECTORSURFACE_H_
+#define VECTORSURFACE_H_
+
+#include <wx/drawsurface.h>
+
+#include <vector>
+
+/**
+ * Drawing surface for vector device contexts, such as SVG file or
+ * printer device contexts.
+ * Connected lines, drawn with the same pen, are joined to polylines,
+ * and each polyline is written as one element. Polylines are simplified
+ * with Douglas-Peucker algorithm: points, that are closer than tolerance
+ * to simplified line, are dropped, so output looks the same at output
+ * resolution. Polylines are written when they are finished, or when
+ * they become too long, so large datasets are not kept in memory.
+ */
+class WXDLLIMPEXP_FREECHART VectorDrawSurface : public DrawSurface
+{
+public:
+	/**
+	 * Constructs new surface.
+	 * @param dc device context to draw to
+	 * @param tolerance maximal distance in device units between
+	 * simplified polyline and dropped points
+	 */
+	VectorDrawSurface(wxDC &dc, double tolerance = 0.5);
+	virtual ~VectorDrawSurface();
+
+	virtual wxDC &GetDC();
+
+	virtual bool IsAntialiased();
+
+	virtual void Flush();
+
+	virtual void SetPen(const wxPen &pen);
+
+	virtual void SetBrush(const wxBrush &brush);
+
+	virtual void DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1);
+
+	virtual void DrawLines(size_t count, const wxPoint *points);
+
+	virtual void DrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height);
+
+	virtual void DrawSymbols(Symbol *symbol, const wxPoint *points, size_t count, wxColour color);
+
+	/**
+	 * Checks whether device context produces vector output (SVG file or printer).
+	 * @param dc device context
+	 * @return true if device context produces vector output
+	 */
+	static bool IsVectorDC(wxDC &dc);
+
+	/**
+	 * Simplifies polyline with Douglas-Peucker algorithm.
+	 * First and last points are always kept.
+	 * @param points polyline points
+	 * @param count point count
+	 * @param tolerance maximal distance between simplified polyline and dropped points
+	 * @param result output for simplified polyline points
+	 */
+	static void Simplify(const wxPoint *points, size_t count, double tolerance, std::vector<wxPoint> &result);
+
+private:
+	void DrawPolyline(const wxPoint *points, size_t count);
+
+	void FlushPolyline();
+
+	wxDC &m_dc;
+	double m_tolerance;
+
+	// current polyline, and its simplified copy
+	std::vector<wxPoint> m_polyline;
+	std::vector<wxPoint> m_simplified;
+};
+
+#endif /*VECTORSURFACE_H_*/
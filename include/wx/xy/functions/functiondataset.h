@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	functiondataset.h
+// Purpose: function dataset base class declaration
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef FUNCTIONDATASET_H_
+#define FUNCTIONDATASET_H_
+
+#include <wx/xy/xydataset.h>
+
+#include <vector>
+
+/**
+ * Base class for function datasets of type: y = f(x).
+ * GetX/GetY return function sampled with fixed x step. XY plot draws
+ * function sampled adaptively for visible x range instead: initial samples
+ * are placed at fixed pixel distance, then samples are added where curve
+ * deviates from straight line more than tolerance. So sample count depends
+ * on data area width, not on zoom level.
+ * Adaptive samples are kept by plot (see FunctionSamples), so dataset
+ * isn't changed while drawn, and can be shared by several plots.
+ */
+class WXDLLIMPEXP_FREECHART FunctionDataset : public XYDataset
+{
+	DECLARE_CLASS(FunctionDataset)
+public:
+	/**
+	 * Constructs new function dataset.
+	 * @param minX minimal x
+	 * @param maxX maximal x
+	 * @param step x step, used by GetX/GetY and to calculate y bounds
+	 */
+	FunctionDataset(double minX, double maxX, double step);
+	virtual ~FunctionDataset();
+
+	virtual double GetX(size_t index, size_t serie);
+
+	virtual double GetY(size_t index, size_t serie);
+
+	virtual size_t GetCount(size_t serie);
+
+	virtual size_t GetSerieCount();
+
+	virtual double GetMinX();
+
+	virtual double GetMaxX();
+
+	virtual double GetMinY();
+
+	virtual double GetMaxY();
+
+	/**
+	 * Samples function adaptively for visible x range.
+	 * Doesn't change dataset, so several plots can sample one function.
+	 * @param minX minimal visible x
+	 * @param maxX maximal visible x
+	 * @param width visible x range width in pixels
+	 * @param yPixelSize vertical pixel size in data units, used to measure
+	 * curve deviation in pixels
+	 * @param xs array to store sample x values
+	 * @param ys array to store sample y values
+	 */
+	void Sample(double minX, double maxX, wxCoord width, double yPixelSize,
+			std::vector<double> &xs, std::vector<double> &ys);
+
+	/**
+	 * Sets maximal distance in pixels between curve and lines
+	 * connecting samples. Default is 0.5 pixel.
+	 * @param tolerance tolerance in pixels
+	 */
+	void SetTolerance(double tolerance);
+
+	/**
+	 * Returns maximal distance in pixels between curve and lines connecting samples.
+	 * @return tolerance in pixels
+	 */
+	double GetTolerance()
+	{
+		return m_tolerance;
+	}
+
+protected:
+	/**
+	 * Calculates function value.
+	 * @param x x value
+	 * @return function value
+	 */
+	virtual double CalcY(double x) = 0;
+
+	/**
+	 * Calculates function values for array of x values.
+	 * Default implementation calls CalcY for each value. Derivative classes
+	 * can override it to evaluate batch in one tight loop.
+	 * @param x array of x values
+	 * @param y array to store function values
+	 * @param count values count
+	 */
+	virtual void CalcYArray(const double *x, double *y, size_t count);
+
+	virtual void InvalidateCaches();
+
+	double m_minX;
+	double m_maxX;
+	double m_step;
+
+private:
+	void UpdateYBounds();
+
+	double m_tolerance;
+
+	// y bounds, calculated with fixed step
+	bool m_yBoundsValid;
+	double m_minY;
+	double m_maxY;
+};
+
+/**
+ * Adaptive samples of function dataset for visible x range.
+ * Kept by plot and drawn instead of function dataset. Samples are
+ * cached until visible range, data area size or function is changed.
+ * Internal class, don't use from programs.
+ */
+class WXDLLIMPEXP_FREECHART FunctionSamples : public XYDataset
+{
+	DECLARE_CLASS(FunctionSamples)
+public:
+	FunctionSamples(FunctionDataset *function);
+	virtual ~FunctionSamples();
+
+	/**
+	 * Samples function for visible x range. Does nothing, if parameters
+	 * are the same as in previous call, and function isn't changed.
+	 * @param minX minimal visible x
+	 * @param maxX maximal visible x
+	 * @param width visible x range width in pixels
+	 * @param yPixelSize vertical pixel size in data units
+	 */
+	void Update(double minX, double maxX, wxCoord width, double yPixelSize);
+
+	FunctionDataset *GetFunction()
+	{
+		return m_function;
+	}
+
+	virtual double GetX(size_t index, size_t serie);
+
+	virtual double GetY(size_t index, size_t serie);
+
+	virtual size_t GetCount(size_t serie);
+
+	virtual size_t GetSerieCount();
+
+	virtual wxString GetSerieName(size_t serie);
+
+private:
+	FunctionDataset *m_function;
+
+	bool m_sampled;
+	std::vector<double> m_xs;
+	std::vector<double> m_ys;
+
+	// parameters of last sampling
+	size_t m_modificationCount;
+	double m_minX;
+	double m_maxX;
+	wxCoord m_width;
+	double m_yPixelSize;
+};
+
+#endif /*FUNCTIONDATASET_H_*/
@@ -10,13 +10,13 @@
 #ifndef POLYNOM_H_
 #define POLYNOM_H_
 
-#include <wx/xy/xydataset.h>
+#include <wx/xy/functions/functiondataset.h>
 
 /**
  * Polynom function of type: y = c0 * x^n + c1 * x^(n-1) + ... + c(n-1) * x + cn
  * where: c0 ... cn - coefficients
  */
-class WXDLLIMPEXP_FREECHART Polynom : public XYDataset
+class WXDLLIMPEXP_FREECHART Polynom : public FunctionDataset
 {
 public:
 	/**
@@ -24,29 +24,21 @@ public:
 	 * @param coefs coefficients for x values
 	 * @param min minimal x value
 	 * @param max maximal x value
-	 * @param step x value step
+	 * @param step x value step, used when polynom is not drawn by plot
 	 */
 	Polynom(double *coefs, size_t coefCount, double min, double max, double step);
 	virtual ~Polynom();
 
-	virtual double GetX(size_t index, size_t serie);
-
-	virtual double GetY(size_t index, size_t serie);
+	virtual wxString GetSerieName(size_t serie);
 
-	virtual size_t GetCount(size_t serie);
+protected:
+	virtual double CalcY(double x);
 
-	virtual size_t GetSerieCount();
-
-	virtual wxString GetSerieName(size_t serie);
+	virtual void CalcYArray(const double *x, double *y, size_t count);
 
 private:
-	double CalcY(double x);
-
 	double *m_coefs;
 	size_t m_coefCount;
-	double m_min;
-	double m_max;
-	double m_step;
 };
 
 #endif /*POLYNOM_H_*/
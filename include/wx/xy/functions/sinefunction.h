@@ -10,12 +10,12 @@
 #ifndef SINEFUNCTION_H_
 #define SINEFUNCTION_H_
 
-#include <wx/xy/xydataset.h>
+#include <wx/xy/functions/functiondataset.h>
 
 /**
  * Sine function of type: y = a * sin(x)
  */
-class WXDLLIMPEXP_FREECHART SineFunction : public XYDataset
+class WXDLLIMPEXP_FREECHART SineFunction : public FunctionDataset
 {
 public:
 	/**
@@ -23,27 +23,20 @@ public:
 	 * @param a y scaling coefficient
 	 * @param min minimal x
 	 * @param max maximal x
-	 * @param step x step
+	 * @param step x step, used when function is not drawn by plot
 	 */
 	SineFunction(double a, double minX, double maxX, double step);
 	virtual ~SineFunction();
 
-	virtual double GetX(size_t index, size_t serie);
-
-	virtual double GetY(size_t index, size_t serie);
+	virtual wxString GetSerieName(size_t serie);
 
-	virtual size_t GetCount(size_t serie);
+protected:
+	virtual double CalcY(double x);
 
-	virtual size_t GetSerieCount();
-
-	virtual wxString GetSerieName(size_t serie);
+	virtual void CalcYArray(const double *x, double *y, size_t count);
 
 private:
 	double m_a;
-
-	double m_minX;
-	double m_maxX;
-	double m_step;
 };
 
 #endif /*SINEFUNCTION_H_*/
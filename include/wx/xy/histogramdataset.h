@@ -0,0 +1,211 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	histogramdataset.h
+// Purpose: histogram dataset declaration
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef HISTOGRAMDATASET_H_
+#define HISTOGRAMDATASET_H_
+
+#include <wx/xy/xydataset.h>
+
+#include <vector>
+
+/**
+ * Histogram dataset, that counts raw samples into bins.
+ * Designed to be drawn by XYHistoRenderer: x values are bin centers,
+ * y values are sample counts.
+ *
+ * Samples are counted into base bins. Bins can have fixed width, fixed width
+ * in logarithmic scale, or be defined by explicit edges.
+ * Displayed bins are made by merging adjacent base bins, so bin count
+ * can be changed (eg. on zoom) without processing samples again.
+ * To allow this, use base bin count much greater than displayed bin count.
+ *
+ * Samples out of base bins range are counted as underflow/overflow, and
+ * not displayed.
+ */
+class WXDLLIMPEXP_FREECHART HistogramDataset : public XYDataset
+{
+	DECLARE_CLASS(HistogramDataset)
+public:
+	/**
+	 * Constructs new histogram dataset with fixed width bins.
+	 * @param minValue lower edge of first bin
+	 * @param maxValue upper edge of last bin
+	 * @param binCount displayed bin count
+	 * @param baseBinCount base bin count, it's rounded up to multiple of binCount
+	 * @param logBins true to use bins with fixed width in logarithmic scale,
+	 * minValue must be positive in this case
+	 */
+	HistogramDataset(double minValue, double maxValue, size_t binCount, size_t baseBinCount = 4096, bool logBins = false);
+
+	/**
+	 * Constructs new histogram dataset with explicit bin edges.
+	 * @param edges bin edges in ascending order, bin n is [edges[n], edges[n + 1])
+	 * @param edgeCount edge count, equal to base bin count + 1
+	 */
+	HistogramDataset(const double *edges, size_t edgeCount);
+
+	virtual ~HistogramDataset();
+
+	virtual double GetX(size_t index, size_t serie);
+
+	virtual double GetY(size_t index, size_t serie);
+
+	virtual size_t GetCount(size_t serie);
+
+	virtual size_t GetSerieCount();
+
+	virtual wxString GetSerieName(size_t serie);
+
+	virtual double GetMinX();
+
+	virtual double GetMaxX();
+
+	virtual double GetMinY();
+
+	virtual double GetMaxY();
+
+	/**
+	 * Sets serie name.
+	 * @param name serie name
+	 */
+	void SetSerieName(const wxString &name);
+
+	/**
+	 * Adds sample. Takes constant time for fixed width bins, and
+	 * logarithmic time (binary search) for explicit edges.
+	 * Use BeginUpdate/EndUpdate to add many samples this way.
+	 * @param value sample value
+	 */
+	void AddSample(double value);
+
+	/**
+	 * Adds array of samples. Samples are counted in parallel threads.
+	 * @param values sample values
+	 * @param count sample count
+	 */
+	void AddSamples(const double *values, size_t count);
+
+	/**
+	 * Removes all samples.
+	 */
+	void Clear();
+
+	/**
+	 * Changes displayed bins to cover whole base bins range.
+	 * @param binCount new displayed bin count
+	 */
+	void Rebin(size_t binCount);
+
+	/**
+	 * Changes displayed bins to cover specified range. Range is
+	 * expanded to nearest base bin edges. Displayed bin edges are aligned
+	 * to base bin edges, so bins have equal width only if base bin count
+	 * in range is multiple of binCount.
+	 * Used to show more detailed histogram, when part of it is zoomed.
+	 * @param minValue minimal value to display
+	 * @param maxValue maximal value to display
+	 * @param binCount new displayed bin count
+	 */
+	void Rebin(double minValue, double maxValue, size_t binCount);
+
+	/**
+	 * Returns lower edge of displayed bin.
+	 * @param index bin index
+	 * @return lower edge
+	 */
+	double GetBinStart(size_t index);
+
+	/**
+	 * Returns upper edge of displayed bin.
+	 * @param index bin index
+	 * @return upper edge
+	 */
+	double GetBinEnd(size_t index);
+
+	/**
+	 * Returns base bin count.
+	 * @return base bin count
+	 */
+	size_t GetBaseBinCount()
+	{
+		return m_baseCounts.size();
+	}
+
+	/**
+	 * Returns total count of added samples, including out of range.
+	 * @return sample count
+	 */
+	double GetSampleCount()
+	{
+		return m_sampleCount;
+	}
+
+	/**
+	 * Returns count of samples less than lower edge of first base bin.
+	 * @return underflow count
+	 */
+	double GetUnderflowCount()
+	{
+		return m_underflowCount;
+	}
+
+	/**
+	 * Returns count of samples greater or equal to upper edge of last
+	 * base bin.
+	 * @return overflow count
+	 */
+	double GetOverflowCount()
+	{
+		return m_overflowCount;
+	}
+
+	/**
+	 * Returns base bin index for value.
+	 * Internal function, don't use from programs.
+	 * @param value sample value
+	 * @return base bin index, or -1 for underflow, or base bin count for overflow
+	 */
+	long FindBaseBin(double value) const;
+
+protected:
+	virtual void InvalidateCaches();
+
+private:
+	double GetBaseEdge(size_t index);
+
+	void UpdateBins();
+
+	wxString m_serieName;
+
+	// base bins
+	bool m_logBins;
+	bool m_explicitEdges;
+	double m_minValue;
+	double m_maxValue;
+	double m_offset;
+	double m_scale;
+	std::vector<double> m_edges;
+	std::vector<double> m_baseCounts;
+
+	double m_sampleCount;
+	double m_underflowCount;
+	double m_overflowCount;
+
+	// displayed bins, as base bins range
+	size_t m_firstBase;
+	size_t m_lastBase;
+	size_t m_binCount;
+
+	// displayed bin counts, calculated from base bins
+	bool m_binsValid;
+	std::vector<double> m_binCounts;
+	double m_maxCount;
+};
+
+#endif /*HISTOGRAMDATASET_H_*/
@@ -12,6 +12,8 @@
 
 #include <wx/xy/xyrenderer.h>
 
+#include <vector>
+
 class WXDLLIMPEXP_FREECHART XYAreaRenderer : public XYRenderer
 {
 	DECLARE_CLASS(XYAreaRenderer)
@@ -21,9 +23,25 @@ public:
 
 	virtual void Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
 
+	virtual void Draw(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
 	virtual void Draw(wxDC &dc, wxRect rcData, wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1);
 
 private:
+#if wxUSE_GRAPHICS_CONTEXT
+	/**
+	 * Draws serie area and outline to graphics context at once.
+	 * Connected segments are joined to one polygon, which is closed,
+	 * when x direction of segments reverses.
+	 * @param dc device context
+	 * @param gc graphics context of device context
+	 * @param rcData data area rectangle
+	 * @param segments visible segments ends, in graphics coordinates,
+	 * two points per segment
+	 */
+	void DrawPath(wxDC &dc, wxGraphicsContext *gc, wxRect rcData, const std::vector<wxPoint> &segments);
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
 	wxPen m_outlinePen;
 	wxBrush m_areaBrush;
 };
@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	xydensityrenderer.h
+// Purpose: xy density (binned heatmap) renderer declarations
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef XYDENSITYRENDERER_H_
+#define XYDENSITYRENDERER_H_
+
+#include <wx/xy/xyrenderer.h>
+
+#include <vector>
+
+/**
+ * Renderer for displaying large XY datasets as point density map.
+ * Points of all series are counted in grid with one cell per pixel of
+ * data area, then counts are mapped to colours and grid is drawn as single
+ * bitmap. So drawing time depends on data area size, not on point count.
+ * Points are counted in parallel threads, so dataset GetX/GetY must be safe
+ * to call from several threads at once, and dataset must not be changed
+ * while it's drawn. Points are counted on calling thread only, if some
+ * axis has nonlinear transform, that calls axis for each value.
+ * Grid is cached until axes window or data area size is changed, or dataset
+ * is modified. If points was only appended to dataset series, only new
+ * points are counted.
+ */
+class WXDLLIMPEXP_FREECHART XYDensityRenderer : public XYRenderer
+{
+	DECLARE_CLASS(XYDensityRenderer)
+public:
+	/**
+	 * Constructs new XYDensityRenderer.
+	 * @param lowColour colour for pixels with minimal point count
+	 * @param highColour colour for pixels with maximal point count
+	 * @param logScale true to map point counts to colours in logarithmic scale
+	 */
+	XYDensityRenderer(const wxColour &lowColour = wxColour(0, 0, 255),
+			const wxColour &highColour = wxColour(255, 0, 0), bool logScale = true);
+	virtual ~XYDensityRenderer();
+
+	virtual void Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
+	virtual void Draw(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
+	virtual void DrawLegendSymbol(wxDC &dc, wxRect rcSymbol, size_t serie);
+
+	/**
+	 * Sets colours for minimal and maximal point counts.
+	 * Colours for counts between them are interpolated.
+	 * @param lowColour colour for pixels with minimal point count
+	 * @param highColour colour for pixels with maximal point count
+	 */
+	void SetColours(const wxColour &lowColour, const wxColour &highColour);
+
+	/**
+	 * Sets whether to map point counts to colours in logarithmic scale.
+	 * @param logScale true to use logarithmic scale, false - linear
+	 */
+	void SetLogScale(bool logScale);
+
+	/**
+	 * Returns whether point counts are mapped to colours in logarithmic scale.
+	 * @return true if logarithmic scale is used
+	 */
+	bool GetLogScale()
+	{
+		return m_logScale;
+	}
+
+	/**
+	 * Returns maximal point count in one pixel, counted on last drawing.
+	 * @return maximal point count
+	 */
+	unsigned int GetMaxCount()
+	{
+		return m_maxCount;
+	}
+
+	/**
+	 * Drops cached grid. Grid will be recounted on next drawing.
+	 * Must be called if dataset points was modified (not appended), and
+	 * dataset doesn't report modification (see Dataset::DatasetChanged).
+	 */
+	void ResetGrid();
+
+private:
+	/**
+	 * State of serie points counted in grid.
+	 */
+	struct SerieState
+	{
+		size_t count;
+		double firstX;
+		double firstY;
+		double lastX;
+		double lastY;
+	};
+
+	bool CanAppend(XYDataset *dataset);
+
+	void SaveSerieState(XYDataset *dataset);
+
+	void UpdateColourTable();
+
+	void UpdateImage();
+
+	wxColour m_lowColour;
+	wxColour m_highColour;
+	bool m_logScale;
+
+	// colour lookup table, 3 bytes per entry
+	std::vector<unsigned char> m_colourTable;
+
+	// grid of point counts
+	bool m_gridValid;
+	std::vector<unsigned int> m_grid;
+	unsigned int m_maxCount;
+
+	// parameters, grid is counted for
+	XYDataset *m_dataset;
+	size_t m_modificationCount;
+	wxCoord m_gridWidth;
+	wxCoord m_gridHeight;
+	double m_minX;
+	double m_maxX;
+	double m_minY;
+	double m_maxY;
+	std::vector<SerieState> m_serieStates;
+
+	// grid image, wxBitmap is created from it only in main thread
+	bool m_imageValid;
+	wxImage m_image;
+};
+
+#endif /*XYDENSITYRENDERER_H_*/
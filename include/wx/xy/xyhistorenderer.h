@@ -30,6 +30,8 @@ public:
 
 	virtual void Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
 
+	virtual void Draw(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
 	/**
 	 * Set area fill to draw specified serie.
 	 * XYHistoRenderer takes ownership of barArea.
@@ -12,6 +12,8 @@
 
 #include <wx/xy/xyrenderer.h>
 #include <wx/art.h>
+#include <wx/pixeloccupancy.h>
+#include <wx/segmentclipper.h>
 
 class WXDLLIMPEXP_FREECHART XYLineRendererBase : public XYRenderer
 {
@@ -48,16 +50,62 @@ public:
 	 */
 	wxPen *GetSeriePen(size_t serie);
 
+	/**
+	 * Turns on/off symbol culling. When turned on, symbol is not drawn,
+	 * if the same serie symbol is already drawn at the same pixel.
+	 * Symbols are never culled on antialiased surfaces, and when serie
+	 * colour is semi-transparent, because overlapping symbols are blended
+	 * there, and culling would change output.
+	 * Turned on by default.
+	 * @param symbolCulling true to turn symbol culling on
+	 */
+	void SetSymbolCulling(bool symbolCulling);
+
+	/**
+	 * Checks whether symbol culling is turned on.
+	 * @return true if symbol culling is turned on
+	 */
+	bool GetSymbolCulling()
+	{
+		return m_symbolCulling;
+	}
+
+	/**
+	 * Returns count of symbols, that was skipped by culling on last drawing.
+	 * @return skipped symbol count
+	 */
+	size_t GetCulledSymbolCount()
+	{
+		return m_symbolOccupancy.GetCulledCount();
+	}
+
   virtual void Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
 
+	virtual void Draw(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
 	//
 	// Renderer
 	//
 	virtual void DrawLegendSymbol(wxDC &dc, wxRect rcSymbol, size_t serie);
 
 protected:
-  virtual void DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset) = 0;
-  virtual void DrawSymbols(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+  virtual void DrawLines(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset) = 0;
+  virtual void DrawSymbols(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
+	virtual void ResolveSerieStyle(size_t serie, SerieStyle &style);
+
+	/**
+	 * Draws serie lines, clipped by visible area, starting from point.
+	 * Points are clipped by chunks, and drawing cancellation is checked
+	 * between them.
+	 * @param surface drawing surface
+	 * @param clipper clipper for axes of dataset
+	 * @param dataset dataset
+	 * @param serie serie index
+	 * @param first index of first point
+	 * @return false if drawing was cancelled
+	 */
+	bool DrawSerieLines(DrawSurface &surface, SegmentClipper &clipper, XYDataset *dataset, size_t serie, size_t first);
 
 	bool m_drawSymbols;
 	bool m_drawLines;
@@ -65,6 +113,9 @@ protected:
 private:
 	PenMap m_seriePens;
 
+	bool m_symbolCulling;
+	PixelOccupancy m_symbolOccupancy;
+
 	int m_defaultPenWidth;
 	wxPenStyle m_defaultPenStyle;
 };
@@ -88,7 +139,7 @@ public:
 
 
 protected:
-  virtual void DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+  virtual void DrawLines(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
 };
 
 /**
@@ -105,7 +156,7 @@ public:
 
 
 protected:
-  virtual void DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+  virtual void DrawLines(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
 
 private:
 	size_t GetFirstVisibleIndex(Axis *horizAxis, Axis *vertAxis, XYDataset *dataset, size_t serie);
@@ -16,6 +16,9 @@
 #include <wx/xy/xydataset.h>
 #include <wx/xy/xyrenderer.h>
 
+class FunctionDataset;
+class FunctionSamples;
+
 /**
  * An plot for displaying XY data values.
  */
@@ -35,13 +38,41 @@ protected:
 
 	virtual void DrawDatasets(wxDC &dc, wxRect rc);
 
+	virtual void DrawDatasets(DrawSurface &surface, wxRect rc);
+
+	virtual bool FindAppendedData(double &minX);
+
 	/**
 	 * Draw single XY dataset.
-	 * @param dc device context
+	 * @param surface drawing surface
 	 * @param rc rectangle where to draw
 	 * @param dataset XY dataset to draw
 	 */
-	void DrawXYDataset(wxDC &dc, wxRect rc, XYDataset *dataset);
+	void DrawXYDataset(DrawSurface &surface, wxRect rc, XYDataset *dataset);
+
+private:
+	/**
+	 * Returns adaptive samples of function, drawn by this plot.
+	 * @param function function dataset
+	 * @return function samples
+	 */
+	FunctionSamples *GetFunctionSamples(FunctionDataset *function);
+
+	/**
+	 * Serie state, used to detect appended data.
+	 */
+	struct SerieState
+	{
+		size_t count;
+		double lastX;
+		double lastY;
+	};
+
+	std::vector<SerieState> m_serieStates;
+
+	// adaptive samples of function datasets, kept by plot,
+	// so plots sharing function don't overwrite each other samples
+	std::vector<FunctionSamples *> m_functionSamples;
 };
 
 #endif /*XYPLOT_H_*/
@@ -13,6 +13,7 @@
 #include <wx/chartrenderer.h>
 #include <wx/axis/axis.h>
 #include <wx/xy/xydataset.h>
+#include <wx/drawsurface.h>
 
 /**
  * Base class for all XYDataset renderers.
@@ -33,6 +34,18 @@ public:
 	 * @param dataset dataset to be drawn
 	 */
 	virtual void Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset) = 0;
+
+	/**
+	 * Draws dataset to drawing surface.
+	 * Default implementation flushes surface and draws to its device context,
+	 * derivative classes can override it to draw to surface directly.
+	 * @param surface drawing surface
+	 * @param rc rectangle where to draw
+	 * @param horizAxis horizontal axis
+	 * @param vertAxis vertical axis
+	 * @param dataset dataset to be drawn
+	 */
+	virtual void Draw(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
 };
 
 #endif /*XYRENDERER_H_*/
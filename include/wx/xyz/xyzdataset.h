@@ -12,7 +12,84 @@
 
 #include <wx/xy/xydataset.h>
 
+#include <vector>
+
 class XYZRenderer;
+class XYZDataset;
+
+/**
+ * Uniform grid index for points of one xyz serie.
+ * Serie bounds are split into cells, so points inside some area
+ * can be found without checking all points of serie.
+ * Internal class, don't use from programs.
+ */
+class WXDLLIMPEXP_FREECHART XYZGridIndex
+{
+public:
+	XYZGridIndex();
+	virtual ~XYZGridIndex();
+
+	/**
+	 * Builds index for points of specified serie.
+	 * @param dataset xyz dataset
+	 * @param serie serie index
+	 */
+	void Build(XYZDataset *dataset, size_t serie);
+
+	/**
+	 * Clears index.
+	 */
+	void Clear();
+
+	/**
+	 * Checks whether index is built.
+	 * @return true if index is built
+	 */
+	bool IsBuilt()
+	{
+		return m_built;
+	}
+
+	/**
+	 * Checks whether all indexed points are inside area.
+	 * @param minX area minimal x
+	 * @param maxX area maximal x
+	 * @param minY area minimal y
+	 * @param maxY area maximal y
+	 * @return true if all points are inside area
+	 */
+	bool IsInside(double minX, double maxX, double minY, double maxY);
+
+	/**
+	 * Finds points, that lies in cells intersecting specified area.
+	 * Indexes of found points are appended to points array, so caller
+	 * must check point coordinates itself.
+	 * @param minX area minimal x
+	 * @param maxX area maximal x
+	 * @param minY area minimal y
+	 * @param maxY area maximal y
+	 * @param points array to append point indexes to
+	 */
+	void Find(double minX, double maxX, double minY, double maxY, std::vector<size_t> &points);
+
+private:
+	size_t CellX(double x);
+	size_t CellY(double y);
+
+	double m_minX;
+	double m_maxX;
+	double m_minY;
+	double m_maxY;
+
+	size_t m_cellsX;
+	size_t m_cellsY;
+
+	// m_points[m_cellStart[cell]..m_cellStart[cell + 1]) are points in cell
+	std::vector<size_t> m_cellStart;
+	std::vector<size_t> m_points;
+
+	bool m_built;
+};
 
 /**
  * Dataset with (x,y,z) coordinate data.
@@ -30,9 +107,49 @@ public:
 
 	virtual double GetZ(size_t index, size_t serie) = 0;
 
+	/**
+	 * Returns minimal z value.
+	 * Value is cached until dataset is changed.
+	 * @return minimal z value
+	 */
 	virtual double GetMinZ();
 
+	/**
+	 * Returns maximal z value.
+	 * Value is cached until dataset is changed.
+	 * @return maximal z value
+	 */
 	virtual double GetMaxZ();
+
+	/**
+	 * Finds points of serie, that can lie in specified area.
+	 * Uses grid index, that is built on first call and dropped when
+	 * dataset is changed. Found points must be checked by caller, because
+	 * points near area can be returned.
+	 * @param serie serie index
+	 * @param minX area minimal x
+	 * @param maxX area maximal x
+	 * @param minY area minimal y
+	 * @param maxY area maximal y
+	 * @param points array to append point indexes to
+	 * @return false if all serie points are inside area, in that case
+	 * points array is not filled
+	 */
+	bool FindPoints(size_t serie, double minX, double maxX, double minY, double maxY, std::vector<size_t> &points);
+
+protected:
+	virtual void InvalidateCaches();
+
+private:
+	void UpdateZRange();
+
+	// cached z range
+	bool m_zRangeValid;
+	double m_minZ;
+	double m_maxZ;
+
+	// grid indexes for series, built on demand
+	std::vector<XYZGridIndex> m_gridIndexes;
 };
 
 #endif /*XYZDATASET_H_*/
@@ -13,6 +13,7 @@
 #include <wx/chartrenderer.h>
 #include <wx/axis/axis.h>
 #include <wx/xyz/xyzdataset.h>
+#include <wx/pixeloccupancy.h>
 
 /**
  * xyz renderer class.
@@ -58,6 +59,35 @@ public:
 	 */
 	wxBrush *GetSerieBrush(size_t serie);
 
+	/**
+	 * Turns on/off bubble culling. When turned on, bubble is not drawn,
+	 * if the same serie bubble with the same radius is already drawn at
+	 * the same pixel. Works only for series with the same outline and fill
+	 * colours. Turned on by default.
+	 * @param bubbleCulling true to turn bubble culling on
+	 */
+	void SetBubbleCulling(bool bubbleCulling);
+
+	/**
+	 * Checks whether bubble culling is turned on.
+	 * @return true if bubble culling is turned on
+	 */
+	bool GetBubbleCulling()
+	{
+		return m_bubbleCulling;
+	}
+
+	/**
+	 * Returns count of bubbles, that was skipped by culling on last drawing.
+	 * @return skipped bubble count
+	 */
+	size_t GetCulledBubbleCount()
+	{
+		return m_bubbleOccupancy.GetCulledCount();
+	}
+
+protected:
+	virtual void ResolveSerieStyle(size_t serie, SerieStyle &style);
 
 private:
 	int m_minRad;
@@ -69,6 +99,9 @@ private:
 
 	BrushMap m_serieBrushs;
 	wxBrushStyle m_defaultBrushStyle;
+
+	bool m_bubbleCulling;
+	PixelOccupancy m_bubbleOccupancy;
 };
 
 #endif /* XYZRENDERER_H_ */
@@ -39,8 +39,8 @@ FillAreaDraw::FillAreaDraw(wxPen borderPen, wxBrush fillBrush)
 
 FillAreaDraw::FillAreaDraw(wxColour borderColour, wxColour fillColour)
 {
-	m_borderPen = *wxThePenList->FindOrCreatePen(borderColour, 1, wxPENSTYLE_SOLID);
-	m_fillBrush = *wxTheBrushList->FindOrCreateBrush(fillColour, wxBRUSHSTYLE_SOLID);
+	m_borderPen = wxPen(borderColour, 1, wxPENSTYLE_SOLID);
+	m_fillBrush = wxBrush(fillColour, wxBRUSHSTYLE_SOLID);
 }
 
 FillAreaDraw::~FillAreaDraw()
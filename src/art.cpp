@@ -7,15 +7,21 @@
 // Licence:	wxWidgets licence
 /////////////////////////////////////////////////////////////////////////////
 
-#include <wx/dynarray.h>
-#include <wx/arrimpl.cpp>
-
 #include <wx/art.h>
 
-WX_DECLARE_OBJARRAY(Symbol *, SymbolArray);
-WX_DEFINE_OBJARRAY(SymbolArray);
-
-SymbolArray defaultSymbols;
+// default symbols are created on load, not on first use, so they can
+// be got from several threads at once without locking
+static SquareSymbol defaultSquareSymbol;
+static TriangleSymbol defaultTriangleSymbol;
+static CircleSymbol defaultCircleSymbol;
+static CrossSymbol defaultCrossSymbol;
+
+static Symbol *defaultSymbols[] = {
+	&defaultSquareSymbol,
+	&defaultTriangleSymbol,
+	&defaultCircleSymbol,
+	&defaultCrossSymbol,
+};
 
 wxColour defaultColours[] = {
 	wxColour(255, 0, 0),
@@ -26,33 +32,22 @@ wxColour defaultColours[] = {
 	// TODO add more colors
 };
 
-void InitDefaultSymbols()
-{
-	defaultSymbols.Add(new SquareSymbol());
-	defaultSymbols.Add(new TriangleSymbol());
-	defaultSymbols.Add(new CircleSymbol());
-	defaultSymbols.Add(new CrossSymbol());
-}
-
 wxColour GetDefaultColour(size_t index)
 {
 	if (index >= WXSIZEOF(defaultColours)) {
 		index = index % WXSIZEOF(defaultColours);
 	}
-	return defaultColours[index];
+
+	// new colour, because reference counter of shared colour data
+	// isn't thread safe
+	const wxColour &colour = defaultColours[index];
+	return wxColour(colour.Red(), colour.Green(), colour.Blue());
 }
 
 Symbol *GetDefaultSymbol(size_t index)
 {
-	size_t count = defaultSymbols.Count();
-
-	if (count == 0) {
-		InitDefaultSymbols();
-		count = defaultSymbols.Count();
-	}
-
-	if (index >= count) {
-		index = index % count;
+	if (index >= WXSIZEOF(defaultSymbols)) {
+		index = index % WXSIZEOF(defaultSymbols);
 	}
 	return defaultSymbols[index];
 }
@@ -9,10 +9,177 @@
 
 #include <wx/axis/axis.h>
 
+#include <string.h>
+#include <float.h>
+
 #include "wx/arrimpl.cpp"
 
 IMPLEMENT_CLASS(Axis, wxObject)
 
+//
+// AxisTransform
+//
+
+static const double ln2 = 0.69314718055994530942;
+
+/**
+ * Returns base 2 logarithm of value, calculated from exponent and series
+ * for mantissa, without calls and branches, so loops with it are
+ * vectorized. Error is less than 2e-6.
+ * Valid only for positive normal values (see IsFastLog2Valid), result
+ * for other values is finite, but wrong.
+ */
+static inline double FastLog2(double value)
+{
+	wxUint64 bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	int exponent = (int) (bits >> 52);
+
+	// mantissa in [1, 2)
+	bits = (bits & wxULL(0x000fffffffffffff)) | wxULL(0x3ff0000000000000);
+	double m;
+	memcpy(&m, &bits, sizeof(m));
+
+	// log(m) = 2 * atanh(t), t = (m - 1) / (m + 1) is in [0, 1/3)
+	double t = (m - 1) / (m + 1);
+	double t2 = t * t;
+	double series = t * (2 + t2 * (2.0 / 3 + t2 * (2.0 / 5 + t2 * (2.0 / 7 + t2 * (2.0 / 9)))));
+
+	return (exponent - 1023) + series / ln2;
+}
+
+/**
+ * Checks whether FastLog2 is valid for value.
+ * @return false for zero, negative, denormal or not finite value
+ */
+static inline bool IsFastLog2Valid(double value)
+{
+	return value >= DBL_MIN && value <= DBL_MAX;
+}
+
+AxisTransform::AxisTransform()
+{
+	m_scale = 0;
+	m_offset = 0;
+	m_logarithmic = false;
+	m_axis = NULL;
+	m_dc = NULL;
+	m_minCoord = 0;
+	m_gRange = 0;
+}
+
+AxisTransform::AxisTransform(int minCoord, int gRange, double minValue, double maxValue, bool vertical, bool logarithmic)
+{
+	// logarithm base doesn't matter for position, natural is used
+	if (logarithmic) {
+		minValue = log(minValue);
+		maxValue = log(maxValue);
+	}
+
+	double valueRange = maxValue - minValue;
+
+	// the same as ::ToGraphics, with coefficients calculated once
+	if (gRange <= 0 || valueRange == 0) {
+		m_scale = 0;
+		m_offset = minCoord;
+	}
+	else if (vertical) {
+		m_scale = -gRange / valueRange;
+		m_offset = minCoord + maxValue * gRange / valueRange;
+	}
+	else {
+		m_scale = gRange / valueRange;
+		m_offset = minCoord - minValue * gRange / valueRange;
+	}
+
+	m_logarithmic = logarithmic;
+	m_axis = NULL;
+	m_dc = NULL;
+	m_minCoord = minCoord;
+	m_gRange = gRange;
+}
+
+AxisTransform::AxisTransform(Axis *axis, wxDC &dc, int minCoord, int gRange)
+{
+	m_scale = 0;
+	m_offset = 0;
+	m_logarithmic = false;
+	m_axis = axis;
+	m_dc = &dc;
+	m_minCoord = minCoord;
+	m_gRange = gRange;
+}
+
+void AxisTransform::ToGraphics(const double *values, wxCoord *coords, size_t count) const
+{
+	if (m_axis != NULL) {
+		for (size_t n = 0; n < count; n++) {
+			coords[n] = m_axis->ToGraphics(*m_dc, m_minCoord, m_gRange, values[n]);
+		}
+		return ;
+	}
+
+	const double offset = m_offset;
+
+	if (m_logarithmic) {
+		// scale for base 2 logarithm
+		const double scale = m_scale * ln2;
+
+		for (size_t n = 0; n < count; n++) {
+			coords[n] = (wxCoord) (FastLog2(values[n]) * scale + offset);
+		}
+
+		// invalid values are rare, so they are fixed in separate pass,
+		// and loop above is kept without branches
+		for (size_t n = 0; n < count; n++) {
+			if (!IsFastLog2Valid(values[n])) {
+				coords[n] = (wxCoord) (log(values[n]) * m_scale + offset);
+			}
+		}
+		return ;
+	}
+
+	const double scale = m_scale;
+
+	for (size_t n = 0; n < count; n++) {
+		coords[n] = (wxCoord) (values[n] * scale + offset);
+	}
+}
+
+void AxisTransform::ToGraphics(const double *values, double *coords, size_t count) const
+{
+	if (m_axis != NULL) {
+		for (size_t n = 0; n < count; n++) {
+			coords[n] = m_axis->ToGraphics(*m_dc, m_minCoord, m_gRange, values[n]);
+		}
+		return ;
+	}
+
+	const double offset = m_offset;
+
+	if (m_logarithmic) {
+		const double scale = m_scale * ln2;
+
+		for (size_t n = 0; n < count; n++) {
+			coords[n] = FastLog2(values[n]) * scale + offset;
+		}
+
+		for (size_t n = 0; n < count; n++) {
+			if (!IsFastLog2Valid(values[n])) {
+				coords[n] = log(values[n]) * m_scale + offset;
+			}
+		}
+		return ;
+	}
+
+	const double scale = m_scale;
+
+	for (size_t n = 0; n < count; n++) {
+		coords[n] = values[n] * scale + offset;
+	}
+}
+
 
 AxisObserver::AxisObserver()
 {
@@ -27,7 +194,7 @@ Axis::Axis(AXIS_LOCATION location)
 	m_location = location;
 
 	// XXX: short dash style drawing hungs, when wxGCDC used
-	m_gridLinesPen = *wxThePenList->FindOrCreatePen(*wxLIGHT_GREY, 1, wxPENSTYLE_DOT);//wxSHORT_DASH);
+	m_gridLinesPen = wxPen(*wxLIGHT_GREY, 1, wxPENSTYLE_DOT);//wxSHORT_DASH);
 
 	m_winPos = 0;
 	m_winWidth = 0;
@@ -108,7 +275,13 @@ double Axis::BoundValue(double value)
 	}
 }
 
-wxCoord Axis::ToGraphics(wxDC& WXUNUSED(dc), int minCoord, int gRange, double value)
+wxCoord Axis::ToGraphics(wxDC &WXUNUSED(dc), int minCoord, int gRange, double value)
+{
+	// not virtual call, derived axes call it to transform their values
+	return GetLinearTransform(minCoord, gRange).ToGraphics(value);
+}
+
+double Axis::ToData(wxDC& WXUNUSED(dc), int minCoord, int gRange, wxCoord g)
 {
 	double minValue, maxValue;
 	GetDataBounds(minValue, maxValue);
@@ -124,10 +297,18 @@ wxCoord Axis::ToGraphics(wxDC& WXUNUSED(dc), int minCoord, int gRange, double va
 		maxValue = m_winPos + m_winWidth;
 	}
 
-	return ::ToGraphics(minCoord, gRange, minValue, maxValue, 0/*textMargin*/, IsVertical(), value);
+	double value = ::ToData(minCoord, gRange, minValue, maxValue, 0/*textMargin*/, IsVertical(), g);
+	return value;
 }
 
-double Axis::ToData(wxDC& WXUNUSED(dc), int minCoord, int gRange, wxCoord g)
+AxisTransform Axis::GetTransform(wxDC &dc, int minCoord, int gRange)
+{
+	// ToGraphics can be overriden by derivative class, so it's called
+	// for each value
+	return AxisTransform(this, dc, minCoord, gRange);
+}
+
+AxisTransform Axis::GetLinearTransform(int minCoord, int gRange)
 {
 	double minValue, maxValue;
 	GetDataBounds(minValue, maxValue);
@@ -143,8 +324,7 @@ double Axis::ToData(wxDC& WXUNUSED(dc), int minCoord, int gRange, wxCoord g)
 		maxValue = m_winPos + m_winWidth;
 	}
 
-	double value = ::ToData(minCoord, gRange, minValue, maxValue, 0/*textMargin*/, IsVertical(), g);
-	return value;
+	return AxisTransform(minCoord, gRange, minValue, maxValue, IsVertical());
 }
 
 //
@@ -210,6 +390,11 @@ double AxisShare::ToData(wxDC &dc, int minCoord, int gRange, wxCoord g)
 	return m_axis->ToData(dc, minCoord, gRange, g);
 }
 
+AxisTransform AxisShare::GetTransform(wxDC &dc, int minCoord, int gRange)
+{
+	return m_axis->GetTransform(dc, minCoord, gRange);
+}
+
 void AxisShare::UpdateBounds()
 {
 	m_axis->UpdateBounds();
@@ -9,6 +9,7 @@
 
 #include <wx/axis/categoryaxis.h>
 #include <wx/category/categorydataset.h>
+#include <wx/textcache.h>
 
 IMPLEMENT_CLASS(CategoryAxis, Axis)
 
@@ -35,7 +36,7 @@ bool CategoryAxis::AcceptDataset(Dataset *dataset)
 wxSize CategoryAxis::GetLongestLabelExtent(wxDC &dc)
 {
 	dc.SetFont(GetLabelTextFont());
-	return dc.GetTextExtent(m_longestCategory);
+	return TextExtentCache::Get()->GetTextExtent(dc, m_longestCategory);
 }
 
 void CategoryAxis::GetDataBounds(double &minValue, double &maxValue) const
@@ -8,6 +8,8 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include "wx/axis/compdateaxis.h"
+#include <wx/textcache.h>
+#include <wx/drawsurface.h>
 #include <wx/arrimpl.cpp>
 
 WX_DEFINE_EXPORTED_OBJARRAY(wxDateSpanArray);
@@ -105,6 +107,51 @@ wxDateTime RoundDateToSpan(wxDateTime date, wxDateSpan span)
 	return wxDateTime(day - modDays, MonthFromNum(month - modMonths), year - modYears);
 }
 
+// average month length in days, used to estimate span count
+static const double daysPerMonth = 30.436875;
+
+/**
+ * Returns date, shifted by several spans.
+ * @param date date
+ * @param span span
+ * @param count span count
+ * @return shifted date
+ */
+static wxDateTime AddSpans(const wxDateTime &date, const wxDateSpan &span, int count)
+{
+	wxDateTime result = date;
+	result += span.Multiply(count);
+	return result;
+}
+
+/**
+ * Calculates maximal count of spans, that can be added to origin date,
+ * so result is not after date. Count is estimated from average span
+ * length and then corrected, so it's calculated in constant time.
+ * @param origin origin date
+ * @param span span
+ * @param date date
+ * @return span count
+ */
+static int SpanCount(const wxDateTime &origin, const wxDateSpan &span, const wxDateTime &date)
+{
+	double spanDays = span.GetTotalMonths() * daysPerMonth + span.GetTotalDays();
+	if (date <= origin || spanDays <= 0) {
+		return 0;
+	}
+
+	double days = (double) (date.GetTicks() - origin.GetTicks()) / (24 * 60 * 60);
+	int count = (int) (days / spanDays);
+
+	while (count > 0 && AddSpans(origin, span, count) > date) {
+		count--;
+	}
+	while (AddSpans(origin, span, count + 1) <= date) {
+		count++;
+	}
+	return count;
+}
+
 /**
  * Calculate number of spans in date interval [first, last].
  * @param first first interval date
@@ -114,15 +161,7 @@ wxDateTime RoundDateToSpan(wxDateTime date, wxDateSpan span)
  */
 int NumOfSpans(wxDateTime first, wxDateTime last, wxDateSpan span)
 {
-	int count = 0;
-
-	wxDateTime date = RoundDateToSpan(first, span);
-	do {
-		date += span;
-		count++;
-	} while (date <= last);
-
-	return count;
+	return SpanCount(RoundDateToSpan(first, span), span, last) + 1;
 }
 
 wxString FormatInterval(int start, int end)
@@ -144,10 +183,11 @@ CompDateAxis::CompDateAxis(AXIS_LOCATION location)
 	m_minLabelGap = 5;
 
 	m_spanDraw = new FillAreaDraw();
-	m_labelFont = *wxNORMAL_FONT;
+	m_labelFont = CopyFont(*wxNORMAL_FONT);
 	m_labelColour = *wxBLACK;
 
 	m_dateCount = 0;
+	m_datesValid = false;
 }
 
 CompDateAxis::~CompDateAxis()
@@ -177,6 +217,7 @@ void CompDateAxis::GetDataBounds(double &minValue, double &maxValue) const
 void CompDateAxis::UpdateBounds()
 {
 	m_dateCount = 0;
+	m_datesValid = false;
 
 	DateTimeDataset *dataset = m_datasets[0]->AsDateTimeDataset();
 	if (dataset->GetCount() < 1) {
@@ -331,7 +372,7 @@ void CompDateAxis::DrawSpan(wxDC &dc, wxRect rcAxis, int spanNum, wxString spanL
 	dc.SetFont(m_labelFont);
 	dc.SetTextForeground(m_labelColour);
 
-	wxSize textExtent = dc.GetTextExtent(spanLabel);
+	wxSize textExtent = TextExtentCache::Get()->GetTextExtent(dc, spanLabel);
 
 	if (IsVertical()) {
 		size = rcSpan.height;
@@ -394,6 +435,12 @@ double CompDateAxis::ToData(wxDC &dc, int minCoord, int gRange, wxCoord g)
 	return value;
 }
 
+AxisTransform CompDateAxis::GetTransform(wxDC &dc, int minCoord, int gRange)
+{
+	// nonlinear, so each value is transformed by ToGraphics
+	return AxisTransform(this, dc, minCoord, gRange);
+}
+
 wxString CompDateAxis::GetSpanLabel(wxDateTime date, wxDateSpan span)
 {
 	int days = span.GetDays();
@@ -459,7 +506,7 @@ wxCoord CompDateAxis::GetSpanExtent(wxDC &dc)
 	dc.SetFont(m_labelFont);
 
 	wxString str = wxT("0123456789ABCDEFG");
-	wxSize textExtent = dc.GetTextExtent(str);
+	wxSize textExtent = TextExtentCache::Get()->GetTextExtent(dc, str);
 
 	wxCoord spanExtent = 2 * m_labelMargin + textExtent.y;
 	return spanExtent;
@@ -486,15 +533,8 @@ bool CompDateAxis::GetWindowDateBounds(wxDateTime &date0, wxDateTime &date1)
 		return false;
 	}
 
-	date0 = date;
-	for (int n = 0; n < firstDateIndex; n++) {
-		date0 += span;
-	}
-
-	date1 = date;
-	for (int n = 0; n < lastDateIndex; n++) {
-		date1 += span;
-	}
+	date0 = AddSpans(date, span, firstDateIndex);
+	date1 = AddSpans(date, span, lastDateIndex);
 	return true;
 }
 
@@ -512,6 +552,12 @@ bool CompDateAxis::GetLastDate(wxDateTime &date)
 
 bool CompDateAxis::GetFirstLastDate(wxDateTime &firstDate, wxDateTime &lastDate)
 {
+	if (m_datesValid) {
+		firstDate = m_firstDate;
+		lastDate = m_lastDate;
+		return true;
+	}
+
 	if (m_datasets.Count() == 0) {
 		return false;
 	}
@@ -532,6 +578,11 @@ bool CompDateAxis::GetFirstLastDate(wxDateTime &firstDate, wxDateTime &lastDate)
 	if (date < lastDate) {
 		lastDate += span;
 	}
+
+	// dates are cached until bounds or spans are changed
+	m_firstDate = firstDate;
+	m_lastDate = lastDate;
+	m_datesValid = true;
 	return true;
 }
 
@@ -558,5 +609,6 @@ double CompDateAxis::DateToDataCoord(wxDateTime &date)
 void CompDateAxis::AddInterval(const wxDateSpan &interval)
 {
 	m_dateSpans.Add(interval);
+	m_datesValid = false;
 	FireAxisChanged();
 }
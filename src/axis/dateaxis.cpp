@@ -8,6 +8,15 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include <wx/axis/dateaxis.h>
+#include <wx/textcache.h>
+
+#include <math.h>
+
+// maximal count of labels, measured to find longest label
+const size_t maxLabelSamples = 64;
+
+// minimal space between neighbour labels
+const wxCoord minLabelSpacing = 10;
 
 IMPLEMENT_CLASS(DateAxis, Axis)
 
@@ -52,12 +61,21 @@ wxSize DateAxis::GetLongestLabelExtent(wxDC &dc)
 	dc.SetFont(GetLabelTextFont());
 
 	wxSize maxExtent(0, 0);
+	if (m_dateCount == 0) {
+		return maxExtent;
+	}
+
+	// labels of the same format have close widths, so evenly spaced
+	// sample of dates is measured, not every date
+	size_t sampleCount = wxMin(m_dateCount, maxLabelSamples);
+
+	for (size_t n = 0; n < sampleCount; n++) {
+		size_t step = (sampleCount > 1) ? n * (m_dateCount - 1) / (sampleCount - 1) : 0;
 
-	for (int step = 0; !IsEnd(step); step++) {
 		wxString label;
 		GetLabel(step, label);
 
-		wxSize labelExtent = dc.GetTextExtent(label);
+		wxSize labelExtent = TextExtentCache::Get()->GetTextExtent(dc, label);
 		maxExtent.x = wxMax(maxExtent.x, labelExtent.x);
 		maxExtent.y = wxMax(maxExtent.y, labelExtent.y);
 	}
@@ -65,6 +83,51 @@ wxSize DateAxis::GetLongestLabelExtent(wxDC &dc)
 	return maxExtent;
 }
 
+void DateAxis::GetStepRange(wxDC &dc, wxRect rc, size_t &first, size_t &last, size_t &stride)
+{
+	first = 0;
+	last = 0;
+	stride = 1;
+
+	if (m_dateCount == 0) {
+		return ;
+	}
+
+	// iterate only dates inside window
+	double winMin, winMax;
+	GetWindowBounds(winMin, winMax);
+
+	if (winMax < 0 || winMin > m_dateCount - 1) {
+		// nothing visible, IsEnd stops iteration
+		first = m_dateCount;
+		return ;
+	}
+
+	first = (winMin > 0) ? (size_t) ceil(winMin) : 0;
+	last = wxMin((size_t) floor(winMax), m_dateCount - 1);
+	if (first > last) {
+		first = m_dateCount;
+		return ;
+	}
+
+	// choose stride, so labels don't overlap
+	wxSize labelExtent = GetLongestLabelExtent(dc);
+	bool alongWidth = (IsVertical() == GetVerticalLabelText());
+
+	wxCoord labelSize = (alongWidth ? labelExtent.x : labelExtent.y) + minLabelSpacing;
+	wxCoord axisSize = IsVertical() ? rc.height : rc.width;
+
+	size_t maxLabels = (labelSize > 0 && axisSize > labelSize) ? (size_t) (axisSize / labelSize) : 1;
+	size_t count = last - first + 1;
+
+	if (count > maxLabels) {
+		stride = (count + maxLabels - 1) / maxLabels;
+
+		// align to stride, so labels don't jump while window scrolls
+		first = (first + stride - 1) / stride * stride;
+	}
+}
+
 void DateAxis::GetDataBounds(double &minValue, double &maxValue) const
 {
 	minValue = 0;
@@ -9,6 +9,8 @@
 
 #include <wx/axis/labelaxis.h>
 #include <wx/drawutils.h>
+#include <wx/textcache.h>
+#include <wx/drawsurface.h>
 
 IMPLEMENT_CLASS(LabelAxis, Axis)
 
@@ -47,14 +49,14 @@ LabelAxis::LabelAxis(AXIS_LOCATION location)
 	m_labelLineSize = 5;
 	m_labelGap = 2;
 
-	m_labelTextFont = *wxNORMAL_FONT;
+	m_labelTextFont = CopyFont(*wxNORMAL_FONT);
 	m_labelTextColour = *wxBLACK;
-	m_labelPen = *wxBLACK_PEN;
+	m_labelPen = wxPen(*wxBLACK, 1, wxPENSTYLE_SOLID);
 	m_verticalLabelText = false;
 	m_majorLabelStep = 1;
 
 	m_title = wxEmptyString;
-	m_titleFont = *wxNORMAL_FONT;
+	m_titleFont = CopyFont(*wxNORMAL_FONT);
 	m_titleColour = *wxBLACK;
 	m_titleLocation = wxCENTER;
 
@@ -81,7 +83,7 @@ wxCoord LabelAxis::GetExtent(wxDC &dc)
 
 	if (m_title.Length() != 0) {
 		dc.SetFont(m_titleFont);
-		titleExtent = dc.GetTextExtent(m_title);
+		titleExtent = TextExtentCache::Get()->GetTextExtent(dc, m_title);
 	}
 
 	if (IsVertical()) {
@@ -112,7 +114,7 @@ wxCoord LabelAxis::GetExtent(wxDC &dc)
 
 void LabelAxis::DrawLabel(wxDC &dc, wxRect rc, const wxString &label, double value, bool isMajorLabel)
 {
-	wxSize labelExtent = dc.GetTextExtent(label);
+	wxSize labelExtent = TextExtentCache::Get()->GetTextExtent(dc, label);
 
 	wxCoord x, y;
 	wxCoord textX, textY;
@@ -227,8 +229,11 @@ void LabelAxis::DrawLabels(wxDC &dc, wxRect rc)
 	dc.SetTextForeground(m_labelTextColour);
 	dc.SetPen(m_labelPen);
 
+	size_t first, last, stride;
+	GetStepRange(dc, rc, first, last, stride);
+
 	wxString label;
-	for (int step = 0; !IsEnd(step) ; step++) {
+	for (size_t step = first; step <= last && !IsEnd(step); step += stride) {
 		double value = GetValue(step);
 		if (!IsVisible(value)) {
 			continue;
@@ -242,6 +247,13 @@ void LabelAxis::DrawLabels(wxDC &dc, wxRect rc)
 	}
 }
 
+void LabelAxis::GetStepRange(wxDC &WXUNUSED(dc), wxRect WXUNUSED(rc), size_t &first, size_t &last, size_t &stride)
+{
+	first = 0;
+	last = (size_t) -1;
+	stride = 1;
+}
+
 void LabelAxis::DrawBorderLine(wxDC &dc, wxRect rc)
 {
 	wxCoord x1, y1;
@@ -275,13 +287,21 @@ void LabelAxis::DrawBorderLine(wxDC &dc, wxRect rc)
 	dc.DrawLine(x1, y1, x2, y2);
 }
 
+AxisTransform LabelAxis::GetTransform(wxDC &WXUNUSED(dc), int minCoord, int gRange)
+{
+	return GetLinearTransform(minCoord, gRange);
+}
+
 void LabelAxis::DrawGridLines(wxDC &dc, wxRect rc)
 {
 	if (!HasLabels()) {
 		return ;
 	}
 
-	for (int nStep = 0; !IsEnd(nStep); nStep++) {
+	size_t first, last, stride;
+	GetStepRange(dc, rc, first, last, stride);
+
+	for (size_t nStep = first; nStep <= last && !IsEnd(nStep); nStep += stride) {
 		m_gridLinesPen.SetColour(m_labelColourer->GetColour(nStep));
 		dc.SetPen(m_gridLinesPen);
 
@@ -323,7 +343,7 @@ void LabelAxis::Draw(wxDC &dc, wxRect rc)
 		return;
 	// draw title
 	if (m_title.Length() != 0) {
-		wxSize titleExtent = dc.GetTextExtent(m_title);
+		wxSize titleExtent = TextExtentCache::Get()->GetTextExtent(dc, m_title);
 
 		dc.SetFont(m_titleFont);
 		dc.SetTextForeground(m_titleColour);
@@ -385,7 +405,7 @@ void LabelAxis::Draw(wxDC &dc, wxRect rc)
 	int y;
 	if (m_title.Length() != 0)
 	{
-		wxSize titleExtent = dc.GetTextExtent(m_title);
+		wxSize titleExtent = TextExtentCache::Get()->GetTextExtent(dc, m_title);
 		wxSize maxLabelExtent = GetLongestLabelExtent(dc);
 		if (GetLocation() == AXIS_RIGHT)
 		{
@@ -112,34 +112,31 @@ void LogarithmicNumberAxis::GetLabel(size_t step, wxString& label)
 	}
 }
 
-wxCoord LogarithmicNumberAxis::ToGraphics(wxDC &WXUNUSED(dc), int minCoord, int gRange, double value)
+wxCoord LogarithmicNumberAxis::ToGraphics(wxDC &dc, int minCoord, int gRange, double value)
+{
+	return GetTransform(dc, minCoord, gRange).ToGraphics(value);
+}
+
+double LogarithmicNumberAxis::ToData(wxDC &WXUNUSED(dc), int minCoord, int gRange, wxCoord g)
 {
 	double minValue, maxValue;
-	GetDataBounds(minValue, maxValue);
+	GetVisibleBounds(minValue, maxValue);
 
 	minCoord += m_marginMin;
 	gRange -= (m_marginMin + m_marginMax);
-
 	if (gRange < 0) {
 		gRange = 0;
 	}
 
-	if (m_useWin) {
-		minValue = m_winPos;
-		maxValue = m_winPos + m_winWidth;
-	}
-
-	double logValue = log(value) / log(m_logBase);
-	double logMax = log(maxValue) / log(m_logBase);
-	double logMin = log(minValue) / log(m_logBase);
-
-	return ::ToGraphics(minCoord, gRange, logMin, logMax, 0/*textMargin*/, IsVertical(), logValue);
+	// logarithm base doesn't matter for position, natural is used
+	double logValue = ::ToData(minCoord, gRange, log(minValue), log(maxValue), 0/*textMargin*/, IsVertical(), g);
+	return exp(logValue);
 }
 
-double LogarithmicNumberAxis::ToData(wxDC &WXUNUSED(dc), int minCoord, int gRange, wxCoord g)
+AxisTransform LogarithmicNumberAxis::GetTransform(wxDC &WXUNUSED(dc), int minCoord, int gRange)
 {
 	double minValue, maxValue;
-	GetDataBounds(minValue, maxValue);
+	GetVisibleBounds(minValue, maxValue);
 
 	minCoord += m_marginMin;
 	gRange -= (m_marginMin + m_marginMax);
@@ -147,14 +144,18 @@ double LogarithmicNumberAxis::ToData(wxDC &WXUNUSED(dc), int minCoord, int gRang
 		gRange = 0;
 	}
 
+	// bounds logarithms are calculated once here, not for each value
+	return AxisTransform(minCoord, gRange, minValue, maxValue, IsVertical(), true);
+}
+
+void LogarithmicNumberAxis::GetVisibleBounds(double &minValue, double &maxValue)
+{
+	GetDataBounds(minValue, maxValue);
+
 	if (m_useWin) {
 		minValue = m_winPos;
 		maxValue = m_winPos + m_winWidth;
 	}
-
-	double logMin = log(minValue) / log(m_logBase);
-	double logMax = log(minValue) / log(m_logBase);
-	return ::ToData(minCoord, gRange, logMin, logMax, 0/*textMargin*/, IsVertical(), g);
 }
 
 double LogarithmicNumberAxis::BoundValue(double value)
@@ -10,6 +10,7 @@
 #include <wx/axis/numberaxis.h>
 #include <wx/xy/xydataset.h>
 #include <wx/category/categorydataset.h>
+#include <wx/textcache.h>
 
 #ifdef WIN32
 #include <float.h>
@@ -64,6 +65,9 @@ NumberAxis::NumberAxis(AXIS_LOCATION location)
 	m_multiplier = 1;
 
 	m_subticks = 10;
+
+	m_boundsMinValue = 0;
+	m_boundsMaxValue = 0;
 }
 
 NumberAxis::~NumberAxis()
@@ -204,8 +208,19 @@ wxSize NumberAxis::GetLongestLabelExtent(wxDC &dc)
 {
 	dc.SetFont(GetLabelTextFont());
 
-	wxSize sizeMinValue = dc.GetTextExtent(wxString::Format(m_tickFormat, m_minValue));
-	wxSize sizeMaxValue = dc.GetTextExtent(wxString::Format(m_tickFormat, m_maxValue));
+	// bounds labels are formatted again only when they are changed
+	if (m_minLabel.IsEmpty() || m_boundsFormat != m_tickFormat ||
+			m_boundsMinValue != m_minValue || m_boundsMaxValue != m_maxValue) {
+		m_boundsFormat = m_tickFormat;
+		m_boundsMinValue = m_minValue;
+		m_boundsMaxValue = m_maxValue;
+
+		m_minLabel = wxString::Format(m_tickFormat, m_minValue);
+		m_maxLabel = wxString::Format(m_tickFormat, m_maxValue);
+	}
+
+	wxSize sizeMinValue = TextExtentCache::Get()->GetTextExtent(dc, m_minLabel);
+	wxSize sizeMaxValue = TextExtentCache::Get()->GetTextExtent(dc, m_maxLabel);
 
 	if (sizeMinValue.x > sizeMaxValue.x) {
 		return sizeMinValue;
@@ -9,6 +9,16 @@
 
 #include <wx/axisplot.h>
 #include <wx/drawutils.h>
+#include <wx/tiledsurface.h>
+#include <wx/vectorsurface.h>
+#include <wx/parallel.h>
+#include <wx/dcmemory.h>
+
+#if wxUSE_GRAPHICS_CONTEXT
+#include <wx/dcgraph.h>
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+#include <math.h>
 
 #include "wx/arrimpl.cpp"
 
@@ -30,6 +40,18 @@ AxisPlot::AxisPlot()
 	m_drawGridVertical = true;
 	m_drawGridHorizontal = true;
 
+	m_rasterRendering = false;
+	m_parallelRendering = true;
+
+	m_stripChart = false;
+	m_stripValid = false;
+	m_stripWinPos = 0;
+	m_stripWinWidth = 0;
+	m_stripAxisWinPos = 0;
+
+	m_layoutValid = false;
+	m_layoutAntialiased = false;
+
 	m_legend = NULL;
 	m_crosshair = NULL;
 	m_dataBackground = NULL;
@@ -97,6 +119,7 @@ void AxisPlot::AddAxis(Axis *axis)
 	}
 
 	axis->AddObserver(this);
+	InvalidateLayout();
 }
 
 bool AxisPlot::HasData()
@@ -208,6 +231,58 @@ void AxisPlot::SetDrawGrid(bool drawGridVertical, bool drawGridHorizontal)
 	FirePlotNeedRedraw();
 }
 
+void AxisPlot::SetRasterRendering(bool rasterRendering)
+{
+	if (m_rasterRendering != rasterRendering) {
+		m_rasterRendering = rasterRendering;
+		FirePlotNeedRedraw();
+	}
+}
+
+void AxisPlot::SetParallelRendering(bool parallelRendering)
+{
+	if (m_parallelRendering != parallelRendering) {
+		m_parallelRendering = parallelRendering;
+		FirePlotNeedRedraw();
+	}
+}
+
+void AxisPlot::SetStripChart(bool stripChart)
+{
+	if (m_stripChart != stripChart) {
+		m_stripChart = stripChart;
+		FirePlotNeedRedraw();
+	}
+}
+
+bool AxisPlot::FindAppendedData(double &WXUNUSED(minX))
+{
+	// can't detect appended data by default
+	return false;
+}
+
+void AxisPlot::FirePlotNeedRedraw()
+{
+	m_stripValid = false;
+	InvalidateLayout();
+	Plot::FirePlotNeedRedraw();
+}
+
+void AxisPlot::InvalidateLayout()
+{
+#if wxUSE_THREADS
+	wxCriticalSectionLocker locker(m_layoutLock);
+#endif
+
+	m_layoutValid = false;
+}
+
+void AxisPlot::DrawDatasets(DrawSurface &surface, wxRect rc)
+{
+	surface.Flush();
+	DrawDatasets(surface.GetDC(), rc);
+}
+
 void AxisPlot::DrawGridLines(wxDC &dc, wxRect rc)
 {
 	if (m_drawGridVertical) {
@@ -254,18 +329,54 @@ void AxisPlot::NeedRedraw(DrawObject *WXUNUSED(obj))
 
 void AxisPlot::DatasetChanged(Dataset *dataset)
 {
+	// serie names shown in legend can be changed
+	InvalidateLayout();
 	UpdateAxis(dataset);
-	FirePlotNeedRedraw();
+
+	// strip chart image can be kept only if data was appended
+	if (!dataset->IsAppendOnlyChange()) {
+		m_stripValid = false;
+	}
+	Plot::FirePlotNeedRedraw();
 }
 
-void AxisPlot::AxisChanged(Axis *WXUNUSED(axis))
+void AxisPlot::DatasetMarkersChanged(Dataset *WXUNUSED(dataset))
 {
-	FirePlotNeedRedraw();
+	// markers have own layer, datasets are not redrawn,
+	// except strip chart image, that contains markers
+	m_stripValid = false;
+	FirePlotLayersNeedRedraw(m_stripChart ? (CHART_LAYER_MARKERS | CHART_LAYER_DATA) : CHART_LAYER_MARKERS);
+}
+
+void AxisPlot::DatasetRendererChanged(Dataset *dataset)
+{
+	m_stripValid = false;
+	DatasetChanged(dataset);
+}
+
+void AxisPlot::AxisChanged(Axis *axis)
+{
+	// strip chart image can be scrolled, when only window position
+	// of horizontal axis is changed
+	if (m_stripValid && axis == GetStripAxis() &&
+			axis->GetWindowWidth() == m_stripWinWidth &&
+			axis->GetWindowPosition() != m_stripAxisWinPos) {
+		m_stripAxisWinPos = axis->GetWindowPosition();
+		InvalidateLayout();
+		Plot::FirePlotNeedRedraw();
+	}
+	else {
+		FirePlotNeedRedraw();
+	}
 }
 
 void AxisPlot::BoundsChanged(Axis *WXUNUSED(axis))
 {
-	FirePlotNeedRedraw();
+	// axis labels, and so axis extent, depend on bounds
+	InvalidateLayout();
+
+	// strip chart checks itself, whether axes transform is changed
+	Plot::FirePlotNeedRedraw();
 }
 
 wxCoord AxisPlot::GetAxesExtent(wxDC &dc, AxisArray *axes)
@@ -287,6 +398,12 @@ bool AxisPlot::ToDataCoords(size_t nData, wxDC &dc, wxRect rc, wxCoord gx, wxCoo
 
 	wxCHECK_MSG(horizAxis != NULL && vertAxis != NULL, false, wxT("AxisPlot::ToDataCoords: dataset not linked with horizontal or vertical axis"));
 
+	// layout uses axes and legend, that must not be used
+	// while chart is drawn in worker thread
+	if (GetChartPanel() != NULL && GetChartPanel()->IsRendering()) {
+		return false;
+	}
+
 	wxRect rcData;
 	wxRect rcLegend;
 
@@ -301,6 +418,44 @@ bool AxisPlot::ToDataCoords(size_t nData, wxDC &dc, wxRect rc, wxCoord gx, wxCoo
 }
 
 void AxisPlot::CalcDataArea(wxDC &dc, wxRect rc, wxRect &rcData, wxRect &rcLegend)
+{
+	// text extents, and so layout, differ on devices with other resolution,
+	// and on graphics contexts
+	wxSize ppi = dc.GetPPI();
+	bool antialiased = IsAntialiasedDC(dc);
+
+	{
+#if wxUSE_THREADS
+		wxCriticalSectionLocker locker(m_layoutLock);
+#endif
+
+		// legend font can be changed without notification, so check it too
+		if (m_layoutValid && m_layoutRect == rc && m_layoutPPI == ppi &&
+				m_layoutAntialiased == antialiased &&
+				(m_legend == NULL || m_legend->GetTextFont().GetRefData() == m_layoutLegendFont.GetRefData())) {
+			rcData = m_layoutData;
+			rcLegend = m_layoutLegend;
+			return ;
+		}
+	}
+
+	wxRect rcOuter = rc;
+	LayoutDataArea(dc, rc, rcData, rcLegend);
+
+#if wxUSE_THREADS
+	wxCriticalSectionLocker locker(m_layoutLock);
+#endif
+
+	m_layoutRect = rcOuter;
+	m_layoutPPI = ppi;
+	m_layoutAntialiased = antialiased;
+	m_layoutData = rcData;
+	m_layoutLegend = rcLegend;
+	m_layoutLegendFont = (m_legend != NULL) ? m_legend->GetTextFont() : wxNullFont;
+	m_layoutValid = true;
+}
+
+void AxisPlot::LayoutDataArea(wxDC &dc, wxRect rc, wxRect &rcData, wxRect &rcLegend)
 {
 	if (m_legend != NULL) {
 		wxSize legendExtent = m_legend->GetExtent(dc, m_datasets);
@@ -454,36 +609,283 @@ void AxisPlot::DrawLegend(wxDC &dc, wxRect rcLegend)
 	}
 }
 
-void AxisPlot::DrawDataArea(wxDC &dc, wxRect rcData)
+void AxisPlot::DrawDatasetsArea(wxDC &dc, wxRect rcData, wxRect clipRc)
+{
+	if (VectorDrawSurface::IsVectorDC(dc)) {
+		// vector output is kept as vectors, but simplified
+		VectorDrawSurface surface(dc);
+		surface.SetCancelToken(GetCancelToken());
+		surface.SetSampleLimit(GetSampleLimit());
+
+		DrawDatasets(surface, rcData);
+		surface.Flush();
+
+		if (surface.IsSampled()) {
+			SetSampled();
+		}
+	}
+	else if (m_rasterRendering && RasterDrawSurface::CanDrawTo(dc)) {
+		bool antialias = IsAntialiasedDC(dc);
+
+		if (m_parallelRendering && GetParallelWorkerCount() > 1) {
+			TiledRasterDrawSurface surface(dc, clipRc, antialias);
+			surface.SetCancelToken(GetCancelToken());
+			surface.SetSampleLimit(GetSampleLimit());
+
+			DrawDatasets(surface, rcData);
+			surface.Flush();
+
+			if (surface.IsSampled()) {
+				SetSampled();
+			}
+		}
+		else {
+			RasterDrawSurface surface(dc, clipRc, antialias);
+			surface.SetCancelToken(GetCancelToken());
+			surface.SetSampleLimit(GetSampleLimit());
+
+			DrawDatasets(surface, rcData);
+			surface.Flush();
+
+			if (surface.IsSampled()) {
+				SetSampled();
+			}
+		}
+	}
+	else {
+		DCDrawSurface surface(dc);
+		surface.SetCancelToken(GetCancelToken());
+		surface.SetSampleLimit(GetSampleLimit());
+
+		DrawDatasets(surface, rcData);
+		surface.Flush();
+
+		if (surface.IsSampled()) {
+			SetSampled();
+		}
+	}
+}
+
+Axis *AxisPlot::GetStripAxis()
+{
+	// strip cache is kept in bitmaps, that can be used from main thread only
+	if (!m_stripChart || m_horizontalAxes.Count() != 1 || !IsMainThread()) {
+		return NULL;
+	}
+
+	// coarse preview is not cached
+	if (GetSampleLimit() != 0) {
+		return NULL;
+	}
+
+	Axis *axis = m_horizontalAxes[0];
+	if (!axis->GetUseWindow() || axis->GetWindowWidth() <= 0) {
+		return NULL;
+	}
+	return axis;
+}
+
+void AxisPlot::DrawStripChart(wxDC &dc, wxRect rcData)
+{
+	// distance from drawn data to redrawn area, to redraw
+	// symbols and line joins
+	const wxCoord overdraw = 16;
+
+	Axis *axis = GetStripAxis();
+
+	double winPos = axis->GetWindowPosition();
+	double winWidth = axis->GetWindowWidth();
+
+	wxCoord xWinStart = axis->ToGraphics(dc, rcData.x, rcData.width, winPos);
+	wxCoord xWinEnd = axis->ToGraphics(dc, rcData.x, rcData.width, winPos + winWidth);
+
+	std::vector<double> vertBounds;
+	for (size_t nAxis = 0; nAxis < m_verticalAxes.Count(); nAxis++) {
+		vertBounds.push_back(m_verticalAxes[nAxis]->ToData(dc, rcData.y, rcData.height, rcData.y));
+		vertBounds.push_back(m_verticalAxes[nAxis]->ToData(dc, rcData.y, rcData.height, rcData.y + rcData.height));
+	}
+
+	double minX = winPos + winWidth;
+	bool appended = FindAppendedData(minX);
+
+	bool redrawAll = !m_stripValid || !appended ||
+		rcData != m_stripRect ||
+		winWidth != m_stripWinWidth ||
+		vertBounds != m_stripVertBounds ||
+		xWinEnd <= xWinStart;
+
+	wxCoord shift = 0;
+	if (!redrawAll) {
+		// scroll cached image by whole pixels, and keep window position
+		// it is drawn for, so rounding errors are not accumulated
+		double pixelWidth = winWidth / (xWinEnd - xWinStart);
+
+		shift = (wxCoord) floor((winPos - m_stripWinPos) / pixelWidth + 0.5);
+		if (shift < 0 || shift >= xWinEnd - xWinStart) {
+			redrawAll = true;
+		}
+		else {
+			m_stripWinPos += shift * pixelWidth;
+		}
+	}
+
+	if (redrawAll) {
+		if (m_stripBitmap.GetWidth() != rcData.width || m_stripBitmap.GetHeight() != rcData.height) {
+			m_stripBitmap.Create(rcData.width, rcData.height);
+			m_stripShiftBitmap.Create(rcData.width, rcData.height);
+		}
+
+		m_stripWinPos = winPos;
+		DrawStripParts(dc, rcData, &rcData, 1);
+	}
+	else {
+		if (shift != 0) {
+			wxMemoryDC srcDC;
+			wxMemoryDC dstDC;
+
+			srcDC.SelectObject(m_stripBitmap);
+			dstDC.SelectObject(m_stripShiftBitmap);
+			dstDC.Blit(0, 0, rcData.width - shift, rcData.height, &srcDC, shift, 0);
+			srcDC.SelectObject(wxNullBitmap);
+			dstDC.SelectObject(wxNullBitmap);
+
+			wxBitmap tmp = m_stripBitmap;
+			m_stripBitmap = m_stripShiftBitmap;
+			m_stripShiftBitmap = tmp;
+		}
+
+		wxRect parts[2];
+		size_t count = 0;
+
+		// left margin contains scrolled out data
+		if (shift != 0 && xWinStart >= rcData.x) {
+			parts[count++] = wxRect(rcData.x, rcData.y, xWinStart - rcData.x + 1, rcData.height);
+		}
+
+		// newly exposed part, and part with appended data
+		wxCoord xFrom = rcData.x + rcData.width;
+		if (shift != 0) {
+			xFrom = xWinEnd - shift - overdraw;
+		}
+		if (minX < winPos + winWidth) {
+			wxCoord xData = axis->ToGraphics(dc, rcData.x, rcData.width, wxMax(minX, winPos));
+			xFrom = wxMin(xFrom, xData - overdraw);
+		}
+		xFrom = wxMax(xFrom, rcData.x);
+		if (xFrom < rcData.x + rcData.width) {
+			parts[count++] = wxRect(xFrom, rcData.y, rcData.x + rcData.width - xFrom, rcData.height);
+		}
+
+		if (count != 0) {
+			DrawStripParts(dc, rcData, parts, count);
+		}
+	}
+
+	// partially drawn cache can't be used
+	m_stripValid = !IsDrawCancelled();
+	m_stripRect = rcData;
+	m_stripWinWidth = winWidth;
+	m_stripAxisWinPos = winPos;
+	m_stripVertBounds = vertBounds;
+
+	dc.DrawBitmap(m_stripBitmap, rcData.x, rcData.y, false);
+}
+
+void AxisPlot::DrawStripParts(wxDC &dc, wxRect rcData, const wxRect *parts, size_t count)
+{
+	wxMemoryDC mdc;
+	mdc.SelectObject(m_stripBitmap);
+
+	// draw with the same antialiasing, as target device context
+#if wxUSE_GRAPHICS_CONTEXT
+	wxGCDC *gdc = NULL;
+	if (IsAntialiasedDC(dc)) {
+		gdc = new wxGCDC(mdc);
+	}
+	wxDC &partDC = (gdc != NULL) ? (wxDC &) *gdc : (wxDC &) mdc;
+#else
+	wxDC &partDC = mdc;
+#endif
+
+	// data area coordinates are kept
+	partDC.SetDeviceOrigin(-rcData.x, -rcData.y);
+
+	for (size_t n = 0; n < count; n++) {
+		wxRect rcPart = parts[n].Intersect(rcData);
+		if (rcPart.IsEmpty()) {
+			continue;
+		}
+
+		wxDCClipper clip(partDC, rcPart);
+
+		m_dataBackground->Draw(partDC, rcData);
+		DrawMarkers(partDC, rcData);
+		DrawGridLines(partDC, rcData);
+		DrawDatasetsArea(partDC, rcData, rcPart);
+	}
+
+#if wxUSE_GRAPHICS_CONTEXT
+	wxDELETE(gdc);
+#endif
+	mdc.SelectObject(wxNullBitmap);
+}
+
+void AxisPlot::DrawDataArea(wxDC &dc, wxRect rcData, int layers)
 {
 	wxRect clipRc = rcData;
 	clipRc.Deflate(1, 1);
 	wxDCClipper clip(dc, clipRc);
 
-	DrawMarkers(dc, rcData);
-	DrawGridLines(dc, rcData);
-	DrawDatasets(dc, rcData);
+	// vector output is not cached to bitmap
+	bool stripChart = (GetStripAxis() != NULL) && !VectorDrawSurface::IsVectorDC(dc);
 
-	if (m_crosshair != NULL) {
-		// TODO crosshair drawing
-		//m_crosshair->Draw(dc, rcData, );
+	// in strip chart mode markers and grid lines are cached with data
+	if ((layers & CHART_LAYER_MARKERS) && !stripChart) {
+		DrawMarkers(dc, rcData);
+		DrawGridLines(dc, rcData);
+	}
+
+	if (layers & CHART_LAYER_DATA) {
+		if (stripChart) {
+			DrawStripChart(dc, rcData);
+		}
+		else {
+			DrawDatasetsArea(dc, rcData, clipRc);
+		}
+	}
+
+	if (layers & CHART_LAYER_OVERLAY) {
+		if (m_crosshair != NULL) {
+			// TODO crosshair drawing
+			//m_crosshair->Draw(dc, rcData, );
+		}
 	}
 }
 
 void AxisPlot::DrawData(wxDC &dc, wxRect rc)
+{
+	DrawDataLayers(dc, rc, CHART_LAYER_ALL);
+}
+
+void AxisPlot::DrawDataLayers(wxDC &dc, wxRect rc, int layers)
 {
 	wxRect rcData;
 	wxRect rcLegend;
 
 	CalcDataArea(dc, rc, rcData, rcLegend);
 
-	m_dataBackground->Draw(dc, rcData);
+	if (layers & CHART_LAYER_STATIC) {
+		m_dataBackground->Draw(dc, rcData);
 
-	DrawAxes(dc, rc, rcData);
+		DrawAxes(dc, rc, rcData);
+	}
 
-	DrawDataArea(dc, rcData);
+	DrawDataArea(dc, rcData, layers);
 
-	DrawLegend(dc, rcLegend);
+	// legend can be placed inside data area, so it's drawn over data
+	if (layers & CHART_LAYER_OVERLAY) {
+		DrawLegend(dc, rcLegend);
+	}
 }
 
 // TODO
@@ -35,6 +35,10 @@ bool BarPlot::AcceptDataset(Dataset *dataset)
 void BarPlot::DrawDatasets(wxDC &dc, wxRect rc)
 {
 	for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
+		if (IsDrawCancelled()) {
+			break;
+		}
+
 		CategoryDataset *dataset = (CategoryDataset *) GetDataset(nData);
 		BarRenderer *renderer = dataset->GetRenderer();
 		wxCHECK_RET(renderer != NULL, wxT("no renderer for data"));
@@ -27,6 +27,9 @@ void BarType::Draw(BarRenderer *barRenderer, wxDC &dc, wxRect rc,
 		Axis *horizAxis, Axis *vertAxis,
 		bool vertical, size_t item, CategoryDataset *dataset)
 {
+	AxisTransform horizTransform = horizAxis->GetTransform(dc, rc.x, rc.width);
+	AxisTransform vertTransform = vertAxis->GetTransform(dc, rc.y, rc.height);
+
 	FOREACH_SERIE(serie, dataset) {
 		// bar geometry params
 		int width;
@@ -51,10 +54,10 @@ void BarType::Draw(BarRenderer *barRenderer, wxDC &dc, wxRect rc,
 		}
 
 		// transform base and value to graphics coordinates
-		wxCoord xBaseG = horizAxis->ToGraphics(dc, rc.x, rc.width, xBase);
-		wxCoord yBaseG = vertAxis->ToGraphics(dc, rc.y, rc.height, yBase);
-		wxCoord xG = horizAxis->ToGraphics(dc, rc.x, rc.width, xVal);
-		wxCoord yG = vertAxis->ToGraphics(dc, rc.y, rc.height, yVal);
+		wxCoord xBaseG = horizTransform.ToGraphics(xBase);
+		wxCoord yBaseG = vertTransform.ToGraphics(yBase);
+		wxCoord xG = horizTransform.ToGraphics(xVal);
+		wxCoord yG = vertTransform.ToGraphics(yVal);
 
 		wxRect rcBar;
 		if (vertical) {
@@ -77,7 +80,7 @@ void BarType::Draw(BarRenderer *barRenderer, wxDC &dc, wxRect rc,
 		}
 
 		// draw bar
-		AreaDraw *barDraw = barRenderer->GetBarDraw(serie);
+		AreaDraw *barDraw = barRenderer->GetSerieStyle(serie).areaDraw;
 		barDraw->Draw(dc, rcBar);
 	}
 }
@@ -249,20 +252,28 @@ void BarRenderer::DrawLegendSymbol(wxDC &dc, wxRect rcSymbol, size_t serie)
 void BarRenderer::SetBarDraw(size_t serie, AreaDraw *areaDraw)
 {
 	m_barDraws.SetAreaDraw(serie, areaDraw);
+	// old area draw is deleted, so resolved styles must be dropped
+	FireNeedRedraw();
 }
 
 AreaDraw *BarRenderer::GetBarDraw(size_t serie)
 {
 	AreaDraw *barDraw = m_barDraws.GetAreaDraw(serie);
 	if (barDraw == NULL) {
-		barDraw = new FillAreaDraw(*wxBLACK_PEN,
-				*wxTheBrushList->FindOrCreateBrush(GetDefaultColour(serie), wxBRUSHSTYLE_SOLID));
+		barDraw = new FillAreaDraw(wxPen(*wxBLACK, 1, wxPENSTYLE_SOLID),
+				wxBrush(GetDefaultColour(serie), wxBRUSHSTYLE_SOLID));
 
 		m_barDraws.SetAreaDraw(serie, barDraw);
 	}
 	return barDraw;
 }
 
+void BarRenderer::ResolveSerieStyle(size_t serie, SerieStyle &style)
+{
+	Renderer::ResolveSerieStyle(serie, style);
+	style.areaDraw = GetBarDraw(serie);
+}
+
 void BarRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, bool vertical, CategoryDataset *dataset)
 {
 	for (size_t n = 0; n < dataset->GetCount(); n++) {
@@ -24,12 +24,12 @@ void CategoryRenderer::DrawLegendSymbol(wxDC &dc, wxRect rcSymbol, size_t serie)
 {
   wxColour colour = m_colorScheme.GetColor(serie);
 
-	dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(colour));
-	dc.SetPen(*wxThePenList->FindOrCreatePen(colour, 1, wxPENSTYLE_SOLID));
+	dc.SetBrush(wxBrush(colour));
+	dc.SetPen(wxPen(colour, 1, wxPENSTYLE_SOLID));
 
 	dc.DrawRectangle(rcSymbol);
 
-	dc.SetPen(*wxThePenList->FindOrCreatePen(*wxBLACK, 1, wxPENSTYLE_SOLID));
+	dc.SetPen(wxPen(*wxBLACK, 1, wxPENSTYLE_SOLID));
 	dc.SetBrush(wxNoBrush);
 
 	dc.DrawRectangle(rcSymbol);
@@ -18,6 +18,11 @@ ChartObserver::~ChartObserver()
 {
 }
 
+void ChartObserver::ChartLayersChanged(Chart *chart, int WXUNUSED(layers))
+{
+	ChartChanged(chart);
+}
+
 Chart::Chart(Plot *plot, const wxString &title)
 {
 	Init(plot, new Header(title));
@@ -34,8 +39,8 @@ void Chart::Init(Plot* plot, Header* header, Footer* footer)
 	wxColour bgColor = wxColour(220, 220, 220);
 
 	m_background = new FillAreaDraw(
-			*wxThePenList->FindOrCreatePen(bgColor, 1, wxPENSTYLE_SOLID),
-			*wxTheBrushList->FindOrCreateBrush(bgColor));
+			wxPen(bgColor, 1, wxPENSTYLE_SOLID),
+			wxBrush(bgColor));
 
 	m_margin = 5;
 
@@ -66,6 +71,19 @@ void Chart::PlotNeedRedraw(Plot *WXUNUSED(plot))
 	FireChartChanged();
 }
 
+void Chart::PlotLayersNeedRedraw(Plot *WXUNUSED(plot), int layers)
+{
+	FireChartLayersChanged(layers);
+}
+
+void Chart::FireChartLayersChanged(int layers)
+{
+	for (std::vector<Observer*>::iterator it = observers.begin();
+		 it < observers.end(); it++) {
+		(*it)->ChartLayersChanged(this, layers);
+	}
+}
+
 void Chart::AxisChanged(Axis *WXUNUSED(axis))
 {
 	// do nothing
@@ -136,8 +154,17 @@ void Chart::SetChartPanel(wxChartPanel *chartPanel)
 
 void Chart::Draw(wxDC &dc, wxRect &rc)
 {
+	DrawLayers(dc, rc, CHART_LAYER_ALL);
+}
+
+bool Chart::DrawLayers(wxDC &dc, wxRect &rc, int layers, CancelToken *cancel, size_t sampleLimit)
+{
+	bool drawStatic = (layers & CHART_LAYER_STATIC) != 0;
+
 	// draw chart background
-	m_background->Draw(dc, rc);
+	if (drawStatic) {
+		m_background->Draw(dc, rc);
+	}
 
 	int topMargin = m_margin;
 	int bottomMargin = m_margin;
@@ -148,7 +175,9 @@ void Chart::Draw(wxDC &dc, wxRect &rc)
 		wxSize headerExtent = m_header->CalculateExtent(dc);
 		headerRect.height = headerExtent.y + m_headerGap;
 		topMargin += headerRect.height;
-		m_header->Draw(dc, headerRect);
+		if (drawStatic) {
+			m_header->Draw(dc, headerRect);
+		}
 	}
 
 	if (m_footer && !m_footer->IsEmpty()) {
@@ -158,9 +187,11 @@ void Chart::Draw(wxDC &dc, wxRect &rc)
 		footerRect.height = footerExtent.y + m_headerGap;
 		footerRect.y = rc.height - footerRect.height;
 		bottomMargin += footerRect.height;
-		m_footer->Draw(dc, footerRect);
+		if (drawStatic) {
+			m_footer->Draw(dc, footerRect);
+		}
 	}
 
 	Margins(rc, m_margin, topMargin, m_margin, bottomMargin);
-	m_plot->Draw(dc, rc);
+	return m_plot->DrawLayers(dc, rc, layers, cancel, sampleLimit);
 }
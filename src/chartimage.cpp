@@ -0,0 +1,126 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	chartimage.cpp
+// Purpose: chart to image renderer implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/chartimage.h>
+#include <wx/drawsurface.h>
+
+#if wxUSE_GRAPHICS_CONTEXT
+#include <wx/dcgraph.h>
+#else
+#include <wx/dcmemory.h>
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+#if wxUSE_SVG
+#include <wx/dcsvg.h>
+#endif /* wxUSE_SVG */
+
+#include <math.h>
+
+ChartImageRenderer::ChartImageRenderer(Chart *chart, bool antialias)
+{
+	m_chart = chart;
+	m_antialias = antialias;
+}
+
+ChartImageRenderer::~ChartImageRenderer()
+{
+}
+
+wxImage ChartImageRenderer::Render(wxSize size)
+{
+	wxImage image;
+	Draw(image, size, 1);
+	return image;
+}
+
+void ChartImageRenderer::Render(wxSize layoutSize, const std::vector<double> &scales, std::vector<wxImage> &images)
+{
+	images.resize(scales.size());
+	for (size_t n = 0; n < scales.size(); n++) {
+		Draw(images[n], layoutSize, scales[n]);
+	}
+}
+
+bool ChartImageRenderer::SaveFile(const wxString &filename, wxSize size, wxBitmapType type)
+{
+	wxImage image = Render(size);
+	if (!image.IsOk()) {
+		return false;
+	}
+	return image.SaveFile(filename, type);
+}
+
+#if wxUSE_SVG
+bool ChartImageRenderer::SaveSVGFile(const wxString &filename, wxSize size)
+{
+	wxCHECK_MSG(m_chart != NULL, false, wxT("no chart to render"));
+
+	if (size.GetWidth() <= 0 || size.GetHeight() <= 0) {
+		return false;
+	}
+
+	wxSVGFileDC dc(filename, size.GetWidth(), size.GetHeight());
+	if (!dc.IsOk()) {
+		return false;
+	}
+
+	wxRect rc(wxPoint(0, 0), size);
+	m_chart->Draw(dc, rc);
+	return true;
+}
+#endif /* wxUSE_SVG */
+
+bool ChartImageRenderer::Draw(wxImage &image, wxSize layoutSize, double scale)
+{
+	image = wxNullImage;
+
+	wxCHECK_MSG(m_chart != NULL, false, wxT("no chart to render"));
+
+	const int width = (int) ceil(layoutSize.GetWidth() * scale);
+	const int height = (int) ceil(layoutSize.GetHeight() * scale);
+	if (width <= 0 || height <= 0) {
+		return false;
+	}
+
+	wxRect rc(wxPoint(0, 0), layoutSize);
+
+#if wxUSE_GRAPHICS_CONTEXT
+	image.Create(width, height);
+
+	// graphics context on image can be used from any thread,
+	// unlike memory device context
+	wxGraphicsContext *gc = wxGraphicsContext::Create(image);
+	if (gc == NULL) {
+		image = wxNullImage;
+		return false;
+	}
+	gc->SetAntialiasMode(m_antialias ? wxANTIALIAS_DEFAULT : wxANTIALIAS_NONE);
+
+	// image is updated, when graphics context is destroyed with dc
+	wxGCDC dc;
+	dc.SetGraphicsContext(gc);
+	dc.SetUserScale(scale, scale);
+
+	m_chart->Draw(dc, rc);
+#else
+	wxCHECK_MSG(IsMainThread(), false, wxT("chart can be rendered only from main thread without wxUSE_GRAPHICS_CONTEXT"));
+
+	wxBitmap bitmap(width, height);
+
+	wxMemoryDC mdc;
+	mdc.SelectObject(bitmap);
+	mdc.SetUserScale(scale, scale);
+
+	m_chart->Draw(mdc, rc);
+
+	mdc.SelectObject(wxNullBitmap);
+	image = bitmap.ConvertToImage();
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+	return true;
+}
@@ -8,12 +8,22 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include <wx/chartpanel.h>
+#include <wx/drawsurface.h>
 #include <wx/dcbuffer.h>
 
 #if wxUSE_GRAPHICS_CONTEXT
 #include <wx/dcgraph.h>
 #endif /* wxUSE_GRAPHICS_CONTEXT */
 
+// background rendering draws on image in worker thread using graphics context
+#define USE_ASYNC_RENDERING (wxUSE_THREADS && wxUSE_GRAPHICS_CONTEXT)
+
+#if USE_ASYNC_RENDERING
+#include <wx/thread.h>
+#endif /* USE_ASYNC_RENDERING */
+
+#include <string.h>
+
 //
 // Events
 //
@@ -32,6 +42,12 @@ DEFINE_EVENT_TYPE(wxEVT_FREECHART_RIGHT_UP)
 const int scrollPixelStep = 100;
 const int stepMult = 100;
 
+const int redrawTimerId = wxID_HIGHEST + 1;
+const int renderThreadId = wxID_HIGHEST + 2;
+
+// default maximal count of points per serie in coarse preview
+const size_t defaultCoarseSampleLimit = 10000;
+
 void GetAxisScrollParams(Axis *axis, int &noUnits, int &pos)
 {
 	double minValue, maxValue;
@@ -46,6 +62,89 @@ void GetAxisScrollParams(Axis *axis, int &noUnits, int &pos)
 }
 
 
+#if USE_ASYNC_RENDERING
+/**
+ * Worker thread, that draws chart to image.
+ * Internal class, don't use from programs.
+ */
+class ChartRenderThread : public wxThread
+{
+public:
+	ChartRenderThread(wxChartPanel *panel, Chart *chart, wxSize size, bool antialias, int renderId)
+	: wxThread(wxTHREAD_JOINABLE)
+	{
+		m_panel = panel;
+		m_chart = chart;
+		m_size = size;
+		m_antialias = antialias;
+		m_renderId = renderId;
+	}
+
+	virtual ~ChartRenderThread()
+	{
+	}
+
+	void Cancel()
+	{
+		m_cancel.Cancel();
+	}
+
+	bool IsCancelled()
+	{
+		return m_cancel.IsCancelled();
+	}
+
+	/**
+	 * Returns drawn chart image. Can be called only after thread is finished.
+	 * @return chart image, or invalid image if chart can't be drawn
+	 */
+	wxImage &GetImage()
+	{
+		return m_image;
+	}
+
+protected:
+	virtual ExitCode Entry();
+
+private:
+	wxChartPanel *m_panel;
+	Chart *m_chart;
+	wxSize m_size;
+	bool m_antialias;
+	int m_renderId;
+
+	wxImage m_image;
+	CancelToken m_cancel;
+};
+
+wxThread::ExitCode ChartRenderThread::Entry()
+{
+	m_image.Create(m_size.GetWidth(), m_size.GetHeight());
+
+	// graphics context on image can be used from worker thread,
+	// unlike memory device context
+	wxGraphicsContext *gc = wxGraphicsContext::Create(m_image);
+	if (gc != NULL) {
+		gc->SetAntialiasMode(m_antialias ? wxANTIALIAS_DEFAULT : wxANTIALIAS_NONE);
+
+		// image is updated, when graphics context is destroyed with dc
+		wxGCDC dc;
+		dc.SetGraphicsContext(gc);
+
+		wxRect rc(wxPoint(0, 0), m_size);
+		m_chart->DrawLayers(dc, rc, CHART_LAYER_ALL, &m_cancel);
+	}
+	else {
+		m_image = wxNullImage;
+	}
+
+	wxThreadEvent *ev = new wxThreadEvent(wxEVT_COMMAND_THREAD, renderThreadId);
+	ev->SetInt(m_renderId);
+	wxQueueEvent(m_panel, ev);
+	return 0;
+}
+#endif /* USE_ASYNC_RENDERING */
+
 //
 // ChartPanelObserver
 //
@@ -82,6 +181,10 @@ BEGIN_EVENT_TABLE(wxChartPanel, wxScrolledWindow)
 	EVT_SIZE(wxChartPanel::OnSize)
 	EVT_SCROLLWIN(wxChartPanel::OnScrollWin)
 	EVT_MOUSE_EVENTS(wxChartPanel::OnMouseEvents)
+	EVT_TIMER(redrawTimerId, wxChartPanel::OnRedrawTimer)
+#if USE_ASYNC_RENDERING
+	EVT_THREAD(renderThreadId, wxChartPanel::OnRenderDone)
+#endif
 END_EVENT_TABLE()
 
 wxChartPanel::wxChartPanel(wxWindow *parent, wxWindowID id, Chart *chart, const wxPoint &pos, const wxSize &size)
@@ -92,6 +195,21 @@ wxChartPanel::wxChartPanel(wxWindow *parent, wxWindowID id, Chart *chart, const
 
 	m_chart = NULL;
 	m_antialias = false;
+	m_dataTransparent = false;
+
+	m_dirtyLayers = 0;
+	m_maxFps = 60;
+	m_redrawTimer.SetOwner(this, redrawTimerId);
+	m_lastRedrawTime = 0;
+
+	m_asyncRendering = false;
+	m_renderThread = NULL;
+	m_renderId = 0;
+	m_renderLayers = 0;
+
+	m_progressiveRendering = false;
+	m_coarseSampleLimit = defaultCoarseSampleLimit;
+	m_refinePending = false;
 
 	m_mode = NULL;
 
@@ -103,12 +221,19 @@ wxChartPanel::wxChartPanel(wxWindow *parent, wxWindowID id, Chart *chart, const
 
 wxChartPanel::~wxChartPanel()
 {
+	m_pendingScrolls.clear();
+	WaitRendering();
+	m_redrawTimer.Stop();
 	SAFE_REMOVE_OBSERVER(this, m_chart);
 	wxDELETE(m_chart);
 }
 
 void wxChartPanel::SetChart(Chart *chart)
 {
+	// old chart can be drawn in worker thread
+	m_pendingScrolls.clear();
+	WaitRendering();
+
 	SAFE_REPLACE_OBSERVER(this, m_chart, chart);
 	if (m_chart != NULL) {
 		m_chart->SetChartPanel(NULL);
@@ -122,8 +247,7 @@ void wxChartPanel::SetChart(Chart *chart)
 
 	RecalcScrollbars();
 
-	RedrawBackBitmap();
-	Refresh(false);
+	ScheduleRedraw(CHART_LAYER_ALL);
 }
 
 Chart *wxChartPanel::GetChart()
@@ -153,8 +277,7 @@ void wxChartPanel::SetAntialias(bool antialias)
 #endif
 		m_antialias = antialias;
 
-		RedrawBackBitmap();
-		Refresh(false);
+		ScheduleRedraw(CHART_LAYER_ALL);
 	}
 }
 
@@ -163,23 +286,343 @@ bool wxChartPanel::GetAntialias()
 	return m_antialias;
 }
 
+void wxChartPanel::SetMaxFps(int maxFps)
+{
+	m_maxFps = wxMax(0, maxFps);
+}
+
+void wxChartPanel::RenderNow()
+{
+	WaitRendering();
+	Render(0);
+}
+
+void wxChartPanel::Render(size_t sampleLimit)
+{
+	m_redrawTimer.Stop();
+
+	if (m_dirtyLayers == 0) {
+		return ;
+	}
+
+#if USE_ASYNC_RENDERING
+	if (m_renderThread != NULL) {
+		// don't wait for worker thread, chart will be drawn
+		// when it stops (see OnRenderDone)
+		m_renderThread->Cancel();
+		return ;
+	}
+#endif
+
+	// changes made while redrawing will be scheduled again
+	int layers = m_dirtyLayers;
+	m_dirtyLayers = 0;
+
+	// layers are not cached by background rendering
+	const wxSize size = GetClientSize();
+	if (m_asyncRendering || m_backBitmap.GetSize() != size) {
+		ResizeBackBitmap(size);
+		layers = CHART_LAYER_ALL;
+	}
+
+	bool sampled = RedrawBackBitmap(layers, sampleLimit);
+	m_lastRedrawTime = wxGetLocalTimeMillis();
+
+	// datasets are redrawn with static and data layers
+	if (layers & (CHART_LAYER_STATIC | CHART_LAYER_DATA)) {
+		m_refinePending = sampled;
+	}
+
+	Refresh(false);
+}
+
+void wxChartPanel::ScheduleRedraw(int layers)
+{
+	m_dirtyLayers |= layers;
+
+#if USE_ASYNC_RENDERING
+	// outdated chart is rendered
+	if (m_renderThread != NULL) {
+		m_renderThread->Cancel();
+	}
+#endif
+
+	if (m_redrawTimer.IsRunning()) {
+		return ; // changes will be drawn with next frame
+	}
+
+	long delay = 0;
+	if (m_maxFps > 0) {
+		long elapsed = (wxGetLocalTimeMillis() - m_lastRedrawTime).ToLong();
+
+		delay = wxMax(0, 1000 / m_maxFps - elapsed);
+	}
+
+	// redraw from event loop, so changes made at once are drawn together
+	m_redrawTimer.Start(wxMax(1, delay), wxTIMER_ONE_SHOT);
+}
+
+void wxChartPanel::OnRedrawTimer(wxTimerEvent &WXUNUSED(ev))
+{
+	if (m_dirtyLayers == 0) {
+		// changes stopped for frame interval, refine coarse preview
+		if (m_refinePending) {
+			m_dirtyLayers = CHART_LAYER_DATA;
+			Render(0);
+		}
+		return ;
+	}
+
+	if (m_progressiveRendering && (m_dirtyLayers & (CHART_LAYER_STATIC | CHART_LAYER_DATA)) != 0) {
+		// show coarse preview at once, and refine it later
+		Render(m_coarseSampleLimit);
+
+		if (!m_refinePending) {
+			return ; // nothing was sampled, preview is exact
+		}
+
+		if (m_asyncRendering) {
+			m_dirtyLayers = CHART_LAYER_ALL;
+			StartRendering();
+		}
+		else {
+			// newer changes restart timer, and will be drawn coarse first
+			long delay = (m_maxFps > 0) ? 1000 / m_maxFps : 0;
+			m_redrawTimer.Start(wxMax(1, delay), wxTIMER_ONE_SHOT);
+		}
+		return ;
+	}
+
+	if (m_asyncRendering) {
+		StartRendering();
+	}
+	else {
+		RenderNow();
+	}
+}
+
+void wxChartPanel::SetProgressiveRendering(bool progressiveRendering)
+{
+	if (m_progressiveRendering != progressiveRendering) {
+		m_progressiveRendering = progressiveRendering;
+
+		if (m_refinePending) {
+			ScheduleRedraw(CHART_LAYER_DATA);
+		}
+	}
+}
+
+void wxChartPanel::SetCoarseSampleLimit(size_t coarseSampleLimit)
+{
+	m_coarseSampleLimit = coarseSampleLimit;
+}
+
+void wxChartPanel::SetAsyncRendering(bool asyncRendering)
+{
+	if (m_asyncRendering != asyncRendering) {
+#if USE_ASYNC_RENDERING
+#else
+		wxASSERT_MSG(!asyncRendering, wxT("Cannot enable background rendering due to missing wxUSE_THREADS or wxUSE_GRAPHICS_CONTEXT"));
+#endif
+		WaitRendering();
+		m_asyncRendering = asyncRendering;
+
+		ScheduleRedraw(CHART_LAYER_ALL);
+	}
+}
+
+void wxChartPanel::CancelRendering()
+{
+#if USE_ASYNC_RENDERING
+	// don't wait for worker thread, cancelled layers will be
+	// scheduled again, when it stops (see OnRenderDone)
+	if (m_renderThread != NULL) {
+		m_renderThread->Cancel();
+	}
+#endif
+}
+
+void wxChartPanel::WaitRendering()
+{
+#if USE_ASYNC_RENDERING
+	if (m_renderThread == NULL) {
+		return ;
+	}
+
+	wxCHECK_RET(IsMainThread(), wxT("wxChartPanel::WaitRendering: must be called from main thread"));
+
+	m_renderThread->Cancel();
+	m_renderThread->Wait();
+	wxDELETE(m_renderThread);
+
+	// completion event from deleted thread will be ignored
+	m_dirtyLayers |= m_renderLayers;
+	m_renderLayers = 0;
+
+	ApplyPendingScrolls();
+#endif
+}
+
+bool wxChartPanel::IsRendering()
+{
+	return m_renderThread != NULL;
+}
+
+void wxChartPanel::StartRendering()
+{
+#if USE_ASYNC_RENDERING
+	if (m_renderThread != NULL) {
+		// cancelled rendering is not finished yet,
+		// rendering will be started again after it
+		return ;
+	}
+
+	if (m_dirtyLayers == 0) {
+		return ;
+	}
+
+	if (m_chart == NULL) {
+		RenderNow();
+		return ;
+	}
+
+	m_renderLayers = m_dirtyLayers;
+	m_dirtyLayers = 0;
+
+	m_renderThread = new ChartRenderThread(this, m_chart, GetClientSize(), m_antialias, ++m_renderId);
+	if (m_renderThread->Create() != wxTHREAD_NO_ERROR || m_renderThread->Run() != wxTHREAD_NO_ERROR) {
+		wxDELETE(m_renderThread);
+		m_renderLayers = 0;
+
+		// draw in main thread instead
+		m_dirtyLayers = CHART_LAYER_ALL;
+		RenderNow();
+	}
+#else
+	RenderNow();
+#endif
+}
+
+void wxChartPanel::OnRenderDone(wxThreadEvent &ev)
+{
+#if USE_ASYNC_RENDERING
+	if (m_renderThread == NULL || ev.GetInt() != m_renderId) {
+		return ; // from cancelled and deleted thread
+	}
+
+	m_renderThread->Wait();
+
+	bool cancelled = m_renderThread->IsCancelled();
+	wxImage &image = m_renderThread->GetImage();
+
+	if (!cancelled && image.IsOk()) {
+		m_backBitmap = wxBitmap(image);
+		m_lastRedrawTime = wxGetLocalTimeMillis();
+		m_refinePending = false;
+
+		Refresh(false);
+	}
+
+	bool failed = !cancelled && !image.IsOk();
+	wxDELETE(m_renderThread);
+
+	if (cancelled) {
+		// layers, that weren't drawn, are still changed
+		m_dirtyLayers |= m_renderLayers;
+	}
+	m_renderLayers = 0;
+
+	// axes are scrolled, when chart isn't drawn any more
+	ApplyPendingScrolls();
+
+	if (failed) {
+		// graphics context can't draw on image, draw in main thread instead
+		m_dirtyLayers = CHART_LAYER_ALL;
+		RenderNow();
+	}
+	else if (m_dirtyLayers != 0) {
+		// chart was changed while rendering
+		ScheduleRedraw(m_dirtyLayers);
+	}
+#else
+	wxUnusedVar(ev);
+#endif
+}
+
 wxBitmap wxChartPanel::CopyBackbuffer()
 {
+	RenderNow();
 	return wxBitmap(m_backBitmap);
 }
 
 void wxChartPanel::ChartChanged(Chart *WXUNUSED(chart))
 {
-	RedrawBackBitmap();
-	Refresh(false);
+	// outdated rendering is cancelled, and chart is drawn again
+	// after worker thread stops
+	CancelRendering();
+
+	ScheduleRedraw(CHART_LAYER_ALL);
 }
 
 void wxChartPanel::ChartScrollsChanged(Chart *WXUNUSED(chart))
 {
+	CancelRendering();
+
 	RecalcScrollbars();
 
-	RedrawBackBitmap();
-	Refresh(false);
+	ScheduleRedraw(CHART_LAYER_ALL);
+}
+
+void wxChartPanel::ChartLayersChanged(Chart *WXUNUSED(chart), int layers)
+{
+	CancelRendering();
+
+	ScheduleRedraw(layers);
+}
+
+void wxChartPanel::SetAxisWindowPosition(Axis *axis, double winPos)
+{
+	if (IsRendering()) {
+		// axis must not be changed while chart is drawn in worker
+		// thread, so it's scrolled after thread stops
+		CancelRendering();
+
+		for (size_t n = 0; n < m_pendingScrolls.size(); n++) {
+			if (m_pendingScrolls[n].axis == axis) {
+				m_pendingScrolls[n].winPos = winPos;
+				return ;
+			}
+		}
+
+		PendingScroll scroll;
+		scroll.axis = axis;
+		scroll.winPos = winPos;
+		m_pendingScrolls.push_back(scroll);
+		return ;
+	}
+
+	axis->SetWindowPosition(winPos);
+}
+
+double wxChartPanel::GetAxisWindowPosition(Axis *axis)
+{
+	for (size_t n = 0; n < m_pendingScrolls.size(); n++) {
+		if (m_pendingScrolls[n].axis == axis) {
+			return m_pendingScrolls[n].winPos;
+		}
+	}
+	return axis->GetWindowPosition();
+}
+
+void wxChartPanel::ApplyPendingScrolls()
+{
+	// axes can notify panel, and so change pending scrolls
+	std::vector<PendingScroll> scrolls;
+	scrolls.swap(m_pendingScrolls);
+
+	for (size_t n = 0; n < scrolls.size(); n++) {
+		scrolls[n].axis->SetWindowPosition(scrolls[n].winPos);
+	}
 }
 
 void wxChartPanel::RecalcScrollbars()
@@ -216,20 +659,43 @@ void wxChartPanel::OnPaint(wxPaintEvent &WXUNUSED(ev))
 
 	if (m_chart != NULL) {
 		dc.DrawBitmap(m_backBitmap, 0, 0, false);
+
+		// last drawn chart image can be smaller than panel, until
+		// it's drawn again with new size
+		const wxSize size = m_backBitmap.GetSize();
+		if (size.x < rc.width || size.y < rc.height) {
+			dc.SetBrush(wxBrush(GetBackgroundColour()));
+			dc.SetPen(wxPen(GetBackgroundColour(), 1, wxPENSTYLE_SOLID));
+			if (size.x < rc.width) {
+				dc.DrawRectangle(size.x, 0, rc.width - size.x, rc.height);
+			}
+			if (size.y < rc.height) {
+				dc.DrawRectangle(0, size.y, wxMin(size.x, rc.width), rc.height - size.y);
+			}
+		}
 	}
 	else {
-		dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(GetBackgroundColour()));
-		dc.SetPen(*wxThePenList->FindOrCreatePen(GetBackgroundColour(), 1, wxPENSTYLE_SOLID));
+		dc.SetBrush(wxBrush(GetBackgroundColour()));
+		dc.SetPen(wxPen(GetBackgroundColour(), 1, wxPENSTYLE_SOLID));
 		dc.DrawRectangle(rc);
 	}
 }
 
 void wxChartPanel::OnSize(wxSizeEvent &ev)
 {
+	if (m_asyncRendering) {
+		// last drawn chart is shown until it's drawn with new size
+		ScheduleRedraw(CHART_LAYER_ALL);
+		Refresh(false);
+		return ;
+	}
+
 	const wxSize size = ev.GetSize();
 	ResizeBackBitmap(size);
 
-	RedrawBackBitmap();
+	// back buffer must have new size before painting
+	m_dirtyLayers = CHART_LAYER_ALL;
+	Render(m_progressiveRendering ? m_coarseSampleLimit : 0);
 	Refresh();
 }
 
@@ -259,7 +725,7 @@ void wxChartPanel::OnScrollWin(wxScrollWinEvent &ev)
 		axis->GetDataBounds(minValue, maxValue);
 		winPos += minValue;
 
-		axis->SetWindowPosition(winPos);
+		SetAxisWindowPosition(axis, winPos);
 	}
 	ev.Skip();
 }
@@ -322,40 +788,131 @@ void wxChartPanel::ScrollAxis(Axis *axis, int d)
 
 	axis->GetDataBounds(minValue, maxValue);
 
-	double winPos = axis->GetWindowPosition();
+	double winPos = GetAxisWindowPosition(axis);
 	winPos += minValue + delta;
 
-	axis->SetWindowPosition(winPos);
+	SetAxisWindowPosition(axis, winPos);
 }
 
-void wxChartPanel::RedrawBackBitmap()
+bool wxChartPanel::RedrawBackBitmap(int layers, size_t sampleLimit)
 {
-	if (m_chart != NULL) {
+	if (m_chart == NULL) {
+		return false;
+	}
+
+	// data area is laid out with static layer
+	if (layers & CHART_LAYER_STATIC) {
+		layers |= CHART_LAYER_MARKERS | CHART_LAYER_DATA;
+	}
+	// opaque data layer contains markers layer
+	if ((layers & CHART_LAYER_MARKERS) && !m_dataTransparent) {
+		layers |= CHART_LAYER_DATA;
+	}
+	// back buffer is composed again, when layer under overlay is changed
+	if (layers & (CHART_LAYER_MARKERS | CHART_LAYER_DATA)) {
+		layers |= CHART_LAYER_OVERLAY;
+	}
+
+	bool sampled = false;
+	if (layers & CHART_LAYER_STATIC) {
+		sampled |= DrawLayer(m_staticBitmap, NULL, CHART_LAYER_STATIC, sampleLimit);
+	}
+	if (layers & CHART_LAYER_MARKERS) {
+		sampled |= DrawLayer(m_markersBitmap, &m_staticBitmap, CHART_LAYER_MARKERS, sampleLimit);
+	}
+	if (layers & CHART_LAYER_DATA) {
+		sampled |= DrawDataLayer(sampleLimit);
+	}
+	if (layers & CHART_LAYER_OVERLAY) {
 		wxMemoryDC mdc;
 		mdc.SelectObject(m_backBitmap);
+		if (m_dataTransparent) {
+			mdc.DrawBitmap(m_markersBitmap, 0, 0, false);
+			mdc.DrawBitmap(m_dataBitmap, 0, 0, true);
+		}
+		else {
+			mdc.DrawBitmap(m_dataBitmap, 0, 0, false);
+		}
+		mdc.SelectObject(wxNullBitmap);
 
-		const wxRect &rc = GetClientRect();
+		sampled |= DrawLayer(m_backBitmap, NULL, CHART_LAYER_OVERLAY, sampleLimit);
+	}
+	return sampled;
+}
+
+bool wxChartPanel::DrawDataLayer(size_t sampleLimit)
+{
+	wxRect rc = GetClientRect();
 
-		// Using graphics context instead of normal DC
-		// allows antialiasing and other features,
-		// i tested it on Linux-wxGTK-2.8.8 and on Windows(tm)-wxWidgets-2.8.8
-		// there is bug with wxSHORT_DASH pen style, it drawing hungs,
-		// when wxGCDC used
 #if wxUSE_GRAPHICS_CONTEXT
-		if (m_antialias) {
-			wxGCDC gdc(mdc);
-			m_chart->Draw((wxDC&) gdc, (wxRect&) rc);
-		}
-		else {
-			m_chart->Draw(mdc, (wxRect&) rc);
+	if (rc.width > 0 && rc.height > 0) {
+		// datasets are drawn to transparent image, so markers layer
+		// can be redrawn without redrawing datasets
+		wxImage image(rc.width, rc.height);
+		image.InitAlpha();
+		memset(image.GetAlpha(), 0, rc.width * rc.height);
+
+		wxGraphicsContext *gc = wxGraphicsContext::Create(image);
+		if (gc != NULL) {
+			gc->SetAntialiasMode(m_antialias ? wxANTIALIAS_DEFAULT : wxANTIALIAS_NONE);
+
+			bool sampled;
+			{
+				// image is updated, when graphics context is destroyed with dc
+				wxGCDC dc;
+				dc.SetGraphicsContext(gc);
+				sampled = m_chart->DrawLayers(dc, rc, CHART_LAYER_DATA, NULL, sampleLimit);
+			}
+
+			m_dataBitmap = wxBitmap(image);
+			m_dataTransparent = true;
+			return sampled;
 		}
+	}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+	// datasets are drawn over copy of markers layer
+	m_dataTransparent = false;
+	return DrawLayer(m_dataBitmap, &m_markersBitmap, CHART_LAYER_DATA, sampleLimit);
+}
+
+bool wxChartPanel::DrawLayer(wxBitmap &bitmap, wxBitmap *below, int layer, size_t sampleLimit)
+{
+	wxMemoryDC mdc;
+	mdc.SelectObject(bitmap);
+
+	if (below != NULL) {
+		mdc.DrawBitmap(*below, 0, 0, false);
+	}
+
+	wxRect rc = GetClientRect();
+
+	// Using graphics context instead of normal DC
+	// allows antialiasing and other features,
+	// i tested it on Linux-wxGTK-2.8.8 and on Windows(tm)-wxWidgets-2.8.8
+	// there is bug with wxSHORT_DASH pen style, it drawing hungs,
+	// when wxGCDC used
+	bool sampled;
+#if wxUSE_GRAPHICS_CONTEXT
+	if (m_antialias) {
+		wxGCDC gdc(mdc);
+		sampled = m_chart->DrawLayers((wxDC&) gdc, rc, layer, NULL, sampleLimit);
+	}
+	else {
+		sampled = m_chart->DrawLayers(mdc, rc, layer, NULL, sampleLimit);
+	}
 #else
-		m_chart->Draw(mdc, (wxRect&) rc);
+	sampled = m_chart->DrawLayers(mdc, rc, layer, NULL, sampleLimit);
 #endif
-	}
+
+	mdc.SelectObject(wxNullBitmap);
+	return sampled;
 }
 
 void wxChartPanel::ResizeBackBitmap(wxSize size)
 {
+	m_staticBitmap.Create(size.GetWidth(), size.GetHeight());
+	m_markersBitmap.Create(size.GetWidth(), size.GetHeight());
+	m_dataBitmap.Create(size.GetWidth(), size.GetHeight());
 	m_backBitmap.Create(size.GetWidth(), size.GetHeight());
 }
@@ -19,6 +19,16 @@ DatasetObserver::~DatasetObserver()
 {
 }
 
+void DatasetObserver::DatasetMarkersChanged(Dataset *dataset)
+{
+	DatasetChanged(dataset);
+}
+
+void DatasetObserver::DatasetRendererChanged(Dataset *dataset)
+{
+	DatasetChanged(dataset);
+}
+
 //
 // Dataset
 //
@@ -30,6 +40,10 @@ Dataset::Dataset()
 	m_renderer = NULL;
 	m_updating = false;
 	m_changed = false;
+	m_rendererChanged = false;
+	m_markersChanged = false;
+	m_appendOnly = true;
+	m_modificationCount = 0;
 }
 
 Dataset::~Dataset()
@@ -47,7 +61,9 @@ void Dataset::SetRenderer(Renderer *renderer)
 {
 	SAFE_REPLACE_OBSERVER(this, m_renderer, renderer);
 	SAFE_REPLACE_UNREF(m_renderer, renderer);
-	DatasetChanged();
+
+	InvalidateCaches();
+	NotifyRendererChanged();
 }
 
 Renderer *Dataset::GetBaseRenderer()
@@ -55,9 +71,24 @@ Renderer *Dataset::GetBaseRenderer()
 	return m_renderer;
 }
 
-void Dataset::NeedRedraw(DrawObject *WXUNUSED(obj))
+void Dataset::NeedRedraw(DrawObject *obj)
 {
-	DatasetChanged();
+	// marker changes don't affect data
+	for (size_t n = 0; n < m_markers.Count(); n++) {
+		if (obj == m_markers[n]) {
+			if (m_updating) {
+				m_markersChanged = true;
+			}
+			else {
+				FireDatasetMarkersChanged();
+			}
+			return ;
+		}
+	}
+
+	// renderer is changed, data is the same
+	InvalidateCaches();
+	NotifyRendererChanged();
 }
 
 void Dataset::BeginUpdate()
@@ -69,27 +100,69 @@ void Dataset::EndUpdate()
 {
 	if (m_updating) {
 		m_updating = false;
+		if (m_rendererChanged) {
+			m_rendererChanged = false;
+			FireDatasetRendererChanged();
+		}
+		if (m_markersChanged) {
+			m_markersChanged = false;
+			FireDatasetMarkersChanged();
+		}
 		if (m_changed) {
+			m_changed = false;
 			FireDatasetChanged();
+			m_appendOnly = true;
 		}
 	}
 }
 
 void Dataset::DatasetChanged()
 {
+	m_appendOnly = false;
+	m_modificationCount++;
+	NotifyChanged();
+}
+
+void Dataset::DatasetAppended()
+{
+	NotifyChanged();
+}
+
+void Dataset::NotifyChanged()
+{
+	InvalidateCaches();
+
 	if (m_updating) {
 		m_changed = true;
 	}
 	else {
 		FireDatasetChanged();
 		m_changed = false;
+		m_appendOnly = true;
 	}
 }
 
+void Dataset::NotifyRendererChanged()
+{
+	// deferred until update end, like data changes
+	if (m_updating) {
+		m_rendererChanged = true;
+	}
+	else {
+		FireDatasetRendererChanged();
+	}
+}
+
+void Dataset::InvalidateCaches()
+{
+	// nothing to invalidate by default
+}
+
 void Dataset::AddMarker(Marker *marker)
 {
 	marker->AddObserver(this);
 	m_markers.Add(marker);
+	FireDatasetMarkersChanged();
 }
 
 size_t Dataset::GetMarkersCount()
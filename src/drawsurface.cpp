@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	drawsurface.cpp
+// Purpose: drawing surface implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/drawsurface.h>
+#include <wx/symbol.h>
+
+#if wxUSE_GRAPHICS_CONTEXT
+#include <wx/dcgraph.h>
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+#if wxUSE_THREADS
+#include <wx/thread.h>
+#endif /* wxUSE_THREADS */
+
+bool IsAntialiasedDC(wxDC &dc)
+{
+#if wxUSE_GRAPHICS_CONTEXT
+	return wxDynamicCast(&dc, wxGCDC) != NULL;
+#else
+	wxUnusedVar(dc);
+	return false;
+#endif
+}
+
+bool IsMainThread()
+{
+#if wxUSE_THREADS
+	return wxThread::IsMain();
+#else
+	return true;
+#endif
+}
+
+wxFont CopyFont(const wxFont &font)
+{
+	if (!font.IsOk()) {
+		return wxNullFont;
+	}
+	return wxFont(font.GetPointSize(), font.GetFamily(), font.GetStyle(),
+			font.GetWeight(), font.GetUnderlined(), font.GetFaceName(),
+			font.GetEncoding());
+}
+
+DrawSurface::DrawSurface()
+{
+	m_cancel = NULL;
+	m_sampleLimit = 0;
+	m_sampled = false;
+}
+
+DrawSurface::~DrawSurface()
+{
+}
+
+//
+// DCDrawSurface
+//
+
+// maximal line count in graphics path, longer paths are stroked by parts
+const size_t maxPathLines = 16384;
+
+DCDrawSurface::DCDrawSurface(wxDC &dc)
+: m_dc(dc)
+{
+#if wxUSE_GRAPHICS_CONTEXT
+	wxGCDC *gcdc = wxDynamicCast(&dc, wxGCDC);
+	m_gc = (gcdc != NULL) ? gcdc->GetGraphicsContext() : NULL;
+	m_pathLines = 0;
+#endif
+}
+
+DCDrawSurface::~DCDrawSurface()
+{
+	FlushPath();
+}
+
+wxDC &DCDrawSurface::GetDC()
+{
+	return m_dc;
+}
+
+bool DCDrawSurface::IsAntialiased()
+{
+	return IsAntialiasedDC(m_dc);
+}
+
+void DCDrawSurface::Flush()
+{
+	FlushPath();
+}
+
+void DCDrawSurface::SetPen(const wxPen &pen)
+{
+	FlushPath();
+	m_dc.SetPen(pen);
+}
+
+void DCDrawSurface::SetBrush(const wxBrush &brush)
+{
+	m_dc.SetBrush(brush);
+}
+
+void DCDrawSurface::DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1)
+{
+#if wxUSE_GRAPHICS_CONTEXT
+	if (m_gc != NULL) {
+		if (m_pathLines == 0) {
+			m_path = m_gc->CreatePath();
+			m_path.MoveToPoint(x0, y0);
+		}
+		else if (m_pathEnd != wxPoint(x0, y0)) {
+			// line isn't connected to previous, start new subpath
+			m_path.MoveToPoint(x0, y0);
+		}
+		m_path.AddLineToPoint(x1, y1);
+		m_pathEnd = wxPoint(x1, y1);
+
+		if (++m_pathLines >= maxPathLines) {
+			FlushPath();
+		}
+		return ;
+	}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+	m_dc.DrawLine(x0, y0, x1, y1);
+}
+
+void DCDrawSurface::DrawLines(size_t count, const wxPoint *points)
+{
+	FlushPath();
+	m_dc.DrawLines(count, points);
+}
+
+void DCDrawSurface::DrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height)
+{
+	FlushPath();
+	m_dc.DrawRectangle(x, y, width, height);
+}
+
+void DCDrawSurface::DrawSymbols(Symbol *symbol, const wxPoint *points, size_t count, wxColour color)
+{
+	FlushPath();
+	symbol->DrawSymbols(m_dc, points, count, color);
+}
+
+void DCDrawSurface::FlushPath()
+{
+#if wxUSE_GRAPHICS_CONTEXT
+	if (m_pathLines != 0) {
+		// graphics context pen is set by device context
+		m_gc->StrokePath(m_path);
+		m_pathLines = 0;
+	}
+#endif
+}
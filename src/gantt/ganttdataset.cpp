@@ -9,6 +9,8 @@
 
 #include <wx/gantt/ganttdataset.h>
 
+#include <algorithm>
+
 IMPLEMENT_CLASS(GanttDataset, CategoryDataset)
 
 GanttDatasetDateHelper::GanttDatasetDateHelper(GanttDataset *ganttDataset)
@@ -30,11 +32,162 @@ size_t GanttDatasetDateHelper::GetCount()
 	return m_ganttDataset->GetDateCount();
 }
 
+//
+// GanttTaskIndex
+//
+
+GanttTaskIndex::GanttTaskIndex()
+{
+	m_maxLevel = -1;
+	m_built = false;
+}
+
+GanttTaskIndex::~GanttTaskIndex()
+{
+}
+
+void GanttTaskIndex::Clear()
+{
+	m_intervals.clear();
+	m_maxLevel = -1;
+	m_built = false;
+}
+
+void GanttTaskIndex::Build(GanttDataset *dataset, size_t serie)
+{
+	const size_t count = dataset->GetCount(serie);
+
+	m_intervals.resize(count);
+	for (size_t n = 0; n < count; n++) {
+		time_t start = dataset->GetStart(n, serie);
+		time_t end = dataset->GetEnd(n, serie);
+
+		m_intervals[n].start = wxMin(start, end);
+		m_intervals[n].end = wxMax(start, end);
+		m_intervals[n].index = n;
+	}
+
+	std::sort(m_intervals.begin(), m_intervals.end());
+
+	m_built = true;
+	m_maxLevel = -1;
+	if (count == 0) {
+		return ;
+	}
+
+	//
+	// Calculate subtree maximal ends for implicit binary tree over
+	// sorted array: nodes at level k have k lowest bits set to 1.
+	//
+	size_t lastIndex = 0;
+	time_t lastEnd = 0;
+	for (size_t n = 0; n < count; n += 2) {
+		lastIndex = n;
+		lastEnd = m_intervals[n].maxEnd = m_intervals[n].end;
+	}
+
+	int level;
+	for (level = 1; ((size_t) 1 << level) <= count; level++) {
+		size_t x = (size_t) 1 << (level - 1);
+		size_t step = x << 2;
+
+		for (size_t n = (x << 1) - 1; n < count; n += step) {
+			time_t endLeft = m_intervals[n - x].maxEnd;
+			time_t endRight = (n + x < count) ? m_intervals[n + x].maxEnd : lastEnd;
+
+			m_intervals[n].maxEnd = wxMax(m_intervals[n].end, wxMax(endLeft, endRight));
+		}
+
+		lastIndex = ((lastIndex >> level) & 1) ? lastIndex - x : lastIndex + x;
+		if (lastIndex < count && m_intervals[lastIndex].maxEnd > lastEnd) {
+			lastEnd = m_intervals[lastIndex].maxEnd;
+		}
+	}
+	m_maxLevel = level - 1;
+}
+
+void GanttTaskIndex::Find(time_t start, time_t end, std::vector<size_t> &tasks)
+{
+	if (m_maxLevel < 0) {
+		return ;
+	}
+
+	struct Node
+	{
+		int level;
+		size_t index;
+		bool leftDone;
+	};
+
+	const size_t count = m_intervals.size();
+
+	// tree depth is limited by bits count in size_t
+	Node stack[128];
+	int top = 0;
+
+	stack[top].level = m_maxLevel;
+	stack[top].index = ((size_t) 1 << m_maxLevel) - 1;
+	stack[top].leftDone = false;
+	top++;
+
+	while (top > 0) {
+		Node node = stack[--top];
+
+		if (node.level <= 3) {
+			// small subtree, scan all its nodes
+			size_t first = node.index >> node.level << node.level;
+			size_t last = first + ((size_t) 1 << (node.level + 1)) - 1;
+			if (last > count) {
+				last = count;
+			}
+
+			for (size_t n = first; n < last && m_intervals[n].start <= end; n++) {
+				if (m_intervals[n].end >= start) {
+					tasks.push_back(m_intervals[n].index);
+				}
+			}
+		}
+		else if (!node.leftDone) {
+			size_t left = node.index - ((size_t) 1 << (node.level - 1));
+
+			// return to this node after left subtree
+			stack[top] = node;
+			stack[top].leftDone = true;
+			top++;
+
+			// left node may be out of range, in that case it has no valid maximal end
+			if (left >= count || m_intervals[left].maxEnd >= start) {
+				stack[top].level = node.level - 1;
+				stack[top].index = left;
+				stack[top].leftDone = false;
+				top++;
+			}
+		}
+		else if (node.index < count && m_intervals[node.index].start <= end) {
+			if (m_intervals[node.index].end >= start) {
+				tasks.push_back(m_intervals[node.index].index);
+			}
+
+			stack[top].level = node.level - 1;
+			stack[top].index = node.index + ((size_t) 1 << (node.level - 1));
+			stack[top].leftDone = false;
+			top++;
+		}
+	}
+}
+
+//
+// GanttDataset
+//
 
 GanttDataset::GanttDataset(size_t dateCount)
 : m_dateHelper(this)
 {
 	m_dateCount = dateCount;
+
+	m_extentsValid = false;
+	m_minStart = 0;
+	m_maxEnd = 0;
 }
 
 GanttDataset::~GanttDataset()
@@ -47,42 +200,71 @@ size_t GanttDataset::GetCount(size_t WXUNUSED(serie))
 	return GetCount();
 }
 
-time_t GanttDataset::GetMinStart()
+void GanttDataset::UpdateExtents()
 {
-	time_t minStart = 0;
+	if (m_extentsValid) {
+		return ;
+	}
 
+	m_minStart = 0;
+	m_maxEnd = 0;
+
+	bool first = true;
 	FOREACH_SERIE(serie, this) {
 		for (size_t index = 0; index < GetCount(); index++) {
 			time_t start = GetStart(index, serie);
+			time_t end = GetEnd(index, serie);
 
-			if (serie == 0 && index == 0) {
-				minStart = start;
+			if (first) {
+				m_minStart = start;
+				m_maxEnd = end;
+				first = false;
 			}
 			else {
-				minStart = wxMin(minStart, start);
+				m_minStart = wxMin(m_minStart, start);
+				m_maxEnd = wxMax(m_maxEnd, end);
 			}
 		}
 	}
-	return minStart;
+
+	m_extentsValid = true;
+}
+
+time_t GanttDataset::GetMinStart()
+{
+	UpdateExtents();
+	return m_minStart;
 }
 
 time_t GanttDataset::GetMaxEnd()
 {
-	time_t maxEnd = 0;
+	UpdateExtents();
+	return m_maxEnd;
+}
 
-	FOREACH_SERIE(serie, this) {
-		for (size_t index = 0; index < GetCount(); index++) {
-			time_t end = GetEnd(index, serie);
+void GanttDataset::FindTasks(size_t serie, time_t start, time_t end, std::vector<size_t> &tasks)
+{
+	wxCHECK_RET(serie < GetSerieCount(), wxT("GanttDataset::FindTasks: Serie index is out of range"));
 
-			if (serie == 0 && index == 0) {
-				maxEnd = end;
-			}
-			else {
-				maxEnd = wxMax(maxEnd, end);
-			}
-		}
+	if (m_taskIndexes.size() != GetSerieCount()) {
+		m_taskIndexes.clear();
+		m_taskIndexes.resize(GetSerieCount());
 	}
-	return maxEnd;
+
+	GanttTaskIndex &taskIndex = m_taskIndexes[serie];
+	if (!taskIndex.IsBuilt()) {
+		taskIndex.Build(this, serie);
+	}
+
+	taskIndex.Find(start, end, tasks);
+}
+
+void GanttDataset::InvalidateCaches()
+{
+	CategoryDataset::InvalidateCaches();
+
+	m_extentsValid = false;
+	m_taskIndexes.clear();
 }
 
 time_t GanttDataset::GetDateInterval()
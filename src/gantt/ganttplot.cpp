@@ -36,6 +36,10 @@ bool GanttPlot::AcceptDataset(Dataset *dataset)
 void GanttPlot::DrawDatasets(wxDC &dc, wxRect rc)
 {
 	for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
+		if (IsDrawCancelled()) {
+			break;
+		}
+
 		GanttDataset *dataset = (GanttDataset *) GetDataset(nData);
 		GanttRenderer *renderer = dataset->GetRenderer();
 		wxCHECK_RET(renderer != NULL, wxT("no renderer for data"));
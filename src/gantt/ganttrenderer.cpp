@@ -9,6 +9,8 @@
 
 #include <wx/gantt/ganttrenderer.h>
 
+#include <math.h>
+
 IMPLEMENT_CLASS(GanttRenderer, Renderer);
 
 GanttRenderer::GanttRenderer(int barWidth, int serieGap)
@@ -25,10 +27,64 @@ void GanttRenderer::Draw(wxDC &dc, wxRect rc, DateAxis *horizAxis, CategoryAxis
 {
 	const int serieCount = dataset->GetSerieCount();
 	const int dateCount = dataset->AsDateTimeDataset()->GetCount() - 1;
+	const size_t taskCount = dataset->GetCount();
 
 	time_t minDate = dataset->GetMinStart();
 	time_t maxDate = dataset->GetMaxEnd();
 
+	if (taskCount == 0 || maxDate <= minDate || dateCount <= 0) {
+		return ;
+	}
+
+	//
+	// Calculate visible time range from horizontal axis bounds at
+	// rectangle edges, so tasks in axis margins are also drawn.
+	//
+	double winStart = horizAxis->ToData(dc, rc.x, rc.width, rc.x);
+	double winEnd = horizAxis->ToData(dc, rc.x, rc.width, rc.x + rc.width);
+
+	double timePerDate = (double) (maxDate - minDate) / (double) dateCount;
+	time_t visibleStart = minDate + (time_t) floor(wxMin(winStart, winEnd) * timePerDate) - 1;
+	time_t visibleEnd = minDate + (time_t) ceil(wxMax(winStart, winEnd) * timePerDate) + 1;
+	if (winStart == winEnd) {
+		// degenerated rectangle, don't cull by time
+		visibleStart = minDate;
+		visibleEnd = maxDate;
+	}
+
+	//
+	// Calculate visible task rows. Bars can be shifted from row position and
+	// may be wider than row pitch, so add rows covered by bar extent.
+	//
+	double rowTop = vertAxis->ToData(dc, rc.y, rc.height, rc.y);
+	double rowBottom = vertAxis->ToData(dc, rc.y, rc.height, rc.y + rc.height);
+	double rowMin = wxMin(rowTop, rowBottom);
+	double rowMax = wxMax(rowTop, rowBottom);
+
+	double rowPitch = (rowMax > rowMin) ? rc.height / (rowMax - rowMin) : rc.height;
+	int barExtent = m_barWidth + serieCount * (m_barWidth + m_serieGap);
+	double rowSlack = 1 + ((rowPitch > 0) ? barExtent / rowPitch : taskCount);
+
+	size_t firstRow = 0;
+	size_t lastRow = taskCount - 1;
+	if (rowMax > rowMin) {
+		if (rowMin - rowSlack > 0) {
+			firstRow = (size_t) (rowMin - rowSlack);
+		}
+		if (rowMax + rowSlack < lastRow) {
+			lastRow = (size_t) ceil(rowMax + rowSlack);
+		}
+	}
+
+	if (firstRow > lastRow) {
+		return ;
+	}
+
+	std::vector<size_t> tasks;
+
+	AxisTransform horizTransform = horizAxis->GetTransform(dc, rc.x, rc.width);
+	AxisTransform vertTransform = vertAxis->GetTransform(dc, rc.y, rc.height);
+
 	FOREACH_SERIE(serie, dataset) {
 		int shift;
 
@@ -39,9 +95,33 @@ void GanttRenderer::Draw(wxDC &dc, wxRect rc, DateAxis *horizAxis, CategoryAxis
 			shift = -m_barWidth / 2;
 		}
 
-		AreaDraw *serieDraw = GetSerieDraw(serie);
+		AreaDraw *serieDraw = GetSerieStyle(serie).areaDraw;
+
+		//
+		// When only small part of rows is visible, check rows directly,
+		// otherwise find tasks in visible time range using interval index.
+		//
+		tasks.clear();
+		if ((lastRow - firstRow + 1) < taskCount / 2) {
+			for (size_t n = firstRow; n <= lastRow; n++) {
+				time_t start = dataset->GetStart(n, serie);
+				time_t end = dataset->GetEnd(n, serie);
+
+				if (wxMax(start, end) >= visibleStart && wxMin(start, end) <= visibleEnd) {
+					tasks.push_back(n);
+				}
+			}
+		}
+		else {
+			dataset->FindTasks(serie, visibleStart, visibleEnd, tasks);
+		}
+
+		for (size_t nTask = 0; nTask < tasks.size(); nTask++) {
+			size_t n = tasks[nTask];
+			if (n < firstRow || n > lastRow) {
+				continue;
+			}
 
-		FOREACH_DATAITEM(n, serie, dataset) {
 			time_t start = dataset->GetStart(n, serie);
 			time_t end = dataset->GetEnd(n, serie);
 
@@ -49,9 +129,9 @@ void GanttRenderer::Draw(wxDC &dc, wxRect rc, DateAxis *horizAxis, CategoryAxis
 			double dend = dateCount * (double) (end - minDate) / (double) (maxDate - minDate);
 
 			wxRect rcTask;
-			rcTask.x = horizAxis->ToGraphics(dc, rc.x, rc.width, dstart);
-			rcTask.width = horizAxis->ToGraphics(dc, rc.x, rc.width, dend) - rcTask.x;
-			rcTask.y = vertAxis->ToGraphics(dc, rc.y, rc.height, n) + shift;
+			rcTask.x = horizTransform.ToGraphics(dstart);
+			rcTask.width = horizTransform.ToGraphics(dend) - rcTask.x;
+			rcTask.y = vertTransform.ToGraphics(n) + shift;
 			rcTask.height = m_barWidth;
 
 			serieDraw->Draw(dc, rcTask);
@@ -63,13 +143,19 @@ AreaDraw *GanttRenderer::GetSerieDraw(size_t serie)
 {
 	AreaDraw *serieDraw = m_serieDraws.GetAreaDraw(serie);
 	if (serieDraw == NULL) {
-		serieDraw = new FillAreaDraw(*wxBLACK_PEN,
-				*wxTheBrushList->FindOrCreateBrush(GetDefaultColour(serie), wxBRUSHSTYLE_SOLID));
+		serieDraw = new FillAreaDraw(wxPen(*wxBLACK, 1, wxPENSTYLE_SOLID),
+				wxBrush(GetDefaultColour(serie), wxBRUSHSTYLE_SOLID));
 		m_serieDraws.SetAreaDraw(serie, serieDraw);
 	}
 	return serieDraw;
 }
 
+void GanttRenderer::ResolveSerieStyle(size_t serie, SerieStyle &style)
+{
+	Renderer::ResolveSerieStyle(serie, style);
+	style.areaDraw = GetSerieDraw(serie);
+}
+
 void GanttRenderer::SetSerieDraw(size_t serie, AreaDraw *areaDraw)
 {
 	m_serieDraws.SetAreaDraw(serie, areaDraw);
@@ -8,6 +8,8 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include <wx/legend.h>
+#include <wx/textcache.h>
+#include <wx/drawsurface.h>
 
 const wxCoord Legend::labelsSpacing = 2;
 
@@ -19,7 +21,7 @@ Legend::Legend(int vertPosition, int horizPosition, AreaDraw *background, int sy
 	m_symbolTextGap = symbolTextGap;
 	m_margin = margin;
 
-	m_font = *wxNORMAL_FONT;
+	m_font = CopyFont(*wxNORMAL_FONT);
 }
 
 Legend::~Legend()
@@ -41,7 +43,7 @@ void Legend::Draw(wxDC &dc, wxRect rc, DatasetArray &datasets)
 
 		FOREACH_SERIE(serie, dataset) {
 			wxString serieName = dataset->GetSerieName(serie);
-			wxSize textExtent = dc.GetTextExtent(serieName);
+			wxSize textExtent = TextExtentCache::Get()->GetTextExtent(dc, serieName);
 
 			Renderer *renderer = dataset->GetBaseRenderer();
 
@@ -69,7 +71,7 @@ void Legend::Draw(wxDC &dc, wxRect rc, CategoryDataset &dataset)
 	for (size_t n = 0; n < dataset.GetCount(); n++) {
 	  
 	  wxString name = dataset.GetName(n);
-	  wxSize textExtent = dc.GetTextExtent(name);
+	  wxSize textExtent = TextExtentCache::Get()->GetTextExtent(dc, name);
 
 	  Renderer *renderer = dataset.GetBaseRenderer();
 	  
@@ -96,7 +98,7 @@ wxSize Legend::GetExtent(wxDC &dc, DatasetArray &datasets)
 		Dataset *dataset = datasets[n];
 
 		FOREACH_SERIE(serie, dataset) {
-			wxSize textExtent = dc.GetTextExtent(dataset->GetSerieName(serie));
+			wxSize textExtent = TextExtentCache::Get()->GetTextExtent(dc, dataset->GetSerieName(serie));
 
 			wxCoord symbolSize = textExtent.y; // symbol rectangle width and height
 
@@ -122,7 +124,7 @@ wxSize Legend::GetExtent(wxDC &dc, CategoryDataset &dataset)
 	extent.y = 2 * m_margin;
 
 	for (size_t n = 0; n < dataset.GetCount(); n++) {
-	  wxSize textExtent = dc.GetTextExtent(dataset.GetName(n));
+	  wxSize textExtent = TextExtentCache::Get()->GetTextExtent(dc, dataset.GetName(n));
 
 	  wxCoord symbolSize = textExtent.y; // symbol rectangle width and height
 
@@ -38,12 +38,22 @@ void MultiPlot::PlotNeedRedraw(Plot *WXUNUSED(plot))
 	FirePlotNeedRedraw();
 }
 
+void MultiPlot::PlotLayersNeedRedraw(Plot *WXUNUSED(plot), int layers)
+{
+	FirePlotLayersNeedRedraw(layers);
+}
+
 bool MultiPlot::HasData()
 {
 	return (m_subPlots.Count() != 0);
 }
 
 void MultiPlot::DrawData(wxDC &dc, wxRect rc)
+{
+	DrawDataLayers(dc, rc, CHART_LAYER_ALL);
+}
+
+void MultiPlot::DrawDataLayers(wxDC &dc, wxRect rc, int layers)
 {
 	wxCHECK_RET(m_rows != 0 || m_cols != 0, wxT("row and column count = 0"));
 
@@ -114,7 +124,13 @@ void MultiPlot::DrawData(wxDC &dc, wxRect rc)
 
 		wxRect subRc(x, y, subWidth, subHeight);
 
-		m_subPlots[n]->Draw(dc, subRc);
+		if (IsDrawCancelled()) {
+			break;
+		}
+
+		if (m_subPlots[n]->DrawLayers(dc, subRc, layers, GetCancelToken(), GetSampleLimit())) {
+			SetSampled();
+		}
 
 		if (vertical) {
 			row++;
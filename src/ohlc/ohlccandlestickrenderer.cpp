@@ -12,9 +12,9 @@
 OHLCCandlestickRenderer::OHLCCandlestickRenderer()
 {
 	// defaults
-	m_outlinePen = *wxBLACK_PEN;
-	m_lowerBrush = *wxBLACK_BRUSH;
-	m_higherBrush = *wxWHITE_BRUSH;
+	m_outlinePen = wxPen(*wxBLACK, 1, wxPENSTYLE_SOLID);
+	m_lowerBrush = wxBrush(*wxBLACK);
+	m_higherBrush = wxBrush(*wxWHITE);
 	m_candleRadius = 5;
 }
 
@@ -13,6 +13,9 @@
 #include <wx/axis/numberaxis.h>
 #include <wx/axis/compdateaxis.h>
 
+// how often drawing cancellation is checked, in items
+const size_t cancelCheckInterval = 4096;
+
 OHLCPlot::OHLCPlot()
 {
 }
@@ -41,6 +44,10 @@ bool OHLCPlot::AcceptDataset(Dataset *dataset)
 void OHLCPlot::DrawDatasets(wxDC &dc, wxRect rc)
 {
 	for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
+		if (IsDrawCancelled()) {
+			break;
+		}
+
 		Dataset *dataset = GetDataset(nData);
 
 		OHLCDataset *ohlcDataset = wxDynamicCast(dataset, OHLCDataset);
@@ -50,7 +57,9 @@ void OHLCPlot::DrawDatasets(wxDC &dc, wxRect rc)
 		else {
 			XYDataset *xyDataset = wxDynamicCast(dataset, XYDataset);
 			if (xyDataset != NULL) {
-				DrawXYDataset(dc, rc, xyDataset);
+				DCDrawSurface surface(dc);
+				surface.SetCancelToken(GetCancelToken());
+				DrawXYDataset(surface, rc, xyDataset);
 			}
 		}
 	}
@@ -67,16 +76,23 @@ void OHLCPlot::DrawOHLCDataset(wxDC &dc, wxRect rc, OHLCDataset *dataset)
 	wxCHECK_RET(vertAxis != NULL, wxT("no axis for data"));
 	wxCHECK_RET(horizAxis != NULL, wxT("no axis for data"));
 
+	AxisTransform horizTransform = horizAxis->GetTransform(dc, rc.x, rc.width);
+	AxisTransform vertTransform = vertAxis->GetTransform(dc, rc.y, rc.height);
+
 	// draw OHLC items
 	for (size_t n = 0; n < dataset->GetCount(); n++) {
+		if ((n % cancelCheckInterval) == 0 && IsDrawCancelled()) {
+			break;
+		}
+
 		OHLCItem *item = dataset->GetItem(n);
 
-		wxCoord open = vertAxis->ToGraphics(dc, rc.y, rc.height, item->open);
-		wxCoord high = vertAxis->ToGraphics(dc, rc.y, rc.height, item->high);
-		wxCoord low = vertAxis->ToGraphics(dc, rc.y, rc.height, item->low);
-		wxCoord close = vertAxis->ToGraphics(dc, rc.y, rc.height, item->close);
+		wxCoord open = vertTransform.ToGraphics(item->open);
+		wxCoord high = vertTransform.ToGraphics(item->high);
+		wxCoord low = vertTransform.ToGraphics(item->low);
+		wxCoord close = vertTransform.ToGraphics(item->close);
 
-		wxCoord x = horizAxis->ToGraphics(dc, rc.x, rc.width, n);//item->date);
+		wxCoord x = horizTransform.ToGraphics(n);//item->date);
 
 		renderer->DrawItem(dc, x, open, high, low, close);
 	}
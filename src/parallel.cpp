@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	parallel.cpp
+// Purpose: parallel processing utilities implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/parallel.h>
+
+#if wxUSE_THREADS
+#include <wx/thread.h>
+#endif
+
+#include <vector>
+
+ParallelTask::ParallelTask()
+{
+}
+
+ParallelTask::~ParallelTask()
+{
+}
+
+#if wxUSE_THREADS
+
+/**
+ * Thread to process part of parallel task.
+ * Internal class, don't use from programs.
+ */
+class ParallelWorker : public wxThread
+{
+public:
+	ParallelWorker(ParallelTask &task, size_t first, size_t last, size_t worker)
+	: wxThread(wxTHREAD_JOINABLE), m_task(task)
+	{
+		m_first = first;
+		m_last = last;
+		m_worker = worker;
+	}
+
+	virtual ~ParallelWorker()
+	{
+	}
+
+protected:
+	virtual ExitCode Entry()
+	{
+		m_task.Run(m_first, m_last, m_worker);
+		return 0;
+	}
+
+private:
+	ParallelTask &m_task;
+	size_t m_first;
+	size_t m_last;
+	size_t m_worker;
+};
+
+#endif /* wxUSE_THREADS */
+
+size_t GetParallelWorkerCount()
+{
+#if wxUSE_THREADS
+	int cpuCount = wxThread::GetCPUCount();
+	if (cpuCount > 1) {
+		return (size_t) cpuCount;
+	}
+#endif
+	return 1;
+}
+
+size_t ParallelFor(ParallelTask &task, size_t count, size_t minItemsPerWorker)
+{
+	if (count == 0) {
+		return 0;
+	}
+
+	size_t workerCount = GetParallelWorkerCount();
+	if (minItemsPerWorker != 0) {
+		workerCount = wxMin(workerCount, count / minItemsPerWorker);
+	}
+	if (workerCount < 2) {
+		task.Run(0, count, 0);
+		return 1;
+	}
+
+#if wxUSE_THREADS
+	size_t partSize = count / workerCount;
+
+	std::vector<ParallelWorker *> workers;
+	std::vector<size_t> inlineParts;
+
+	// first part is processed in calling thread, start threads for others
+	for (size_t n = 1; n < workerCount; n++) {
+		size_t first = n * partSize;
+		size_t last = (n == workerCount - 1) ? count : first + partSize;
+
+		ParallelWorker *worker = new ParallelWorker(task, first, last, n);
+		if (worker->Create() != wxTHREAD_NO_ERROR || worker->Run() != wxTHREAD_NO_ERROR) {
+			// can't start thread, process this part later in calling thread
+			delete worker;
+			inlineParts.push_back(n);
+			continue;
+		}
+		workers.push_back(worker);
+	}
+
+	task.Run(0, partSize, 0);
+
+	for (size_t n = 0; n < inlineParts.size(); n++) {
+		size_t first = inlineParts[n] * partSize;
+		size_t last = (inlineParts[n] == workerCount - 1) ? count : first + partSize;
+
+		task.Run(first, last, inlineParts[n]);
+	}
+
+	for (size_t n = 0; n < workers.size(); n++) {
+		workers[n]->Wait();
+		delete workers[n];
+	}
+	return workerCount;
+#else
+	task.Run(0, count, 0);
+	return 1;
+#endif
+}
@@ -10,6 +10,7 @@
 #include <wx/pie/pieplot.h>
 #include <wx/drawutils.h>
 #include <wx/drawobject.h>
+#include <wx/drawsurface.h>
 
 #include <math.h>
 
@@ -41,8 +42,8 @@ PiePlot::PiePlot()
 	m_use3DView = false;
 	m_ellipticAspect = 1.0f;
 	//colorScheme = defaultColorScheme;
-	m_outlinePen = *wxBLACK_PEN;
-	m_labelsFont = *wxSMALL_FONT;
+	m_outlinePen = wxPen(*wxBLACK, 1, wxPENSTYLE_SOLID);
+	m_labelsFont = CopyFont(*wxSMALL_FONT);
 
 	m_serie = 0; // default behaviour - use first serie
 
@@ -198,7 +199,7 @@ void PiePlot::DrawData(wxDC &dc, wxRect rc)
 
 		double angle2 = 360 * part;
 
-		dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(m_colorScheme.GetColor(n)));
+		dc.SetBrush(wxBrush(m_colorScheme.GetColor(n)));
 
 		dc.DrawEllipticArc(x0, y0, radHoriz, radVert, angle1, angle2);
 	}
@@ -242,7 +243,7 @@ void PiePlot::DrawData(wxDC &dc, wxRect rc)
 
 				EllipticEgde(x0, y0, radHoriz, radVert, a, x1, y1);
 
-				dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(m_colorScheme.GetColor(n)));
+				dc.SetBrush(wxBrush(m_colorScheme.GetColor(n)));
 				dc.FloodFill(x1, y1 + shift3D / 2, m_outlinePen.GetColour(), wxFLOOD_BORDER);
 			}
 		}
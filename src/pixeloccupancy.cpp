@@ -0,0 +1,30 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	pixeloccupancy.cpp
+// Purpose: pixel occupancy bitmap implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/pixeloccupancy.h>
+
+PixelOccupancy::PixelOccupancy()
+{
+	m_cleared = false;
+	m_culledCount = 0;
+}
+
+PixelOccupancy::~PixelOccupancy()
+{
+}
+
+void PixelOccupancy::Reset(wxRect rc)
+{
+	if (rc.width < 0 || rc.height < 0) {
+		rc.width = rc.height = 0;
+	}
+
+	m_rc = rc;
+	m_cleared = false;
+}
@@ -9,6 +9,7 @@
 
 #include <wx/plot.h>
 #include <wx/drawutils.h>
+#include <wx/drawsurface.h>
 
 PlotObserver::PlotObserver()
 {
@@ -18,15 +19,23 @@ PlotObserver::~PlotObserver()
 {
 }
 
+void PlotObserver::PlotLayersNeedRedraw(Plot *_plot, int WXUNUSED(layers))
+{
+	PlotNeedRedraw(_plot);
+}
+
 
 Plot::Plot()
 {
-	m_textNoDataFont = *wxNORMAL_FONT;
+	m_textNoDataFont = CopyFont(*wxNORMAL_FONT);
 	m_textNoData = wxT("No data");
 
 	m_background = new NoAreaDraw();
 
 	m_chartPanel = NULL;
+	m_cancel = NULL;
+	m_sampleLimit = 0;
+	m_sampled = false;
 }
 
 Plot::~Plot()
@@ -36,14 +45,39 @@ Plot::~Plot()
 
 void Plot::Draw(wxDC &dc, wxRect rc)
 {
-	m_background->Draw(dc, rc);
+	DrawLayers(dc, rc, CHART_LAYER_ALL);
+}
+
+bool Plot::DrawLayers(wxDC &dc, wxRect rc, int layers, CancelToken *cancel, size_t sampleLimit)
+{
+	m_cancel = cancel;
+	m_sampleLimit = sampleLimit;
+	m_sampled = false;
+
+	if (layers & CHART_LAYER_STATIC) {
+		m_background->Draw(dc, rc);
+	}
 
 	if (HasData()) {
-		DrawData(dc, rc);
+		DrawDataLayers(dc, rc, layers);
 	}
-	else {
+	else if (layers & CHART_LAYER_STATIC) {
 		DrawNoDataMessage(dc, rc);
 	}
+
+	m_cancel = NULL;
+	m_sampleLimit = 0;
+
+	bool sampled = m_sampled;
+	m_sampled = false;
+	return sampled;
+}
+
+void Plot::DrawDataLayers(wxDC &dc, wxRect rc, int layers)
+{
+	if (layers & CHART_LAYER_STATIC) {
+		DrawData(dc, rc);
+	}
 }
 
 void Plot::DrawNoDataMessage(wxDC &dc, wxRect rc)
@@ -67,3 +101,11 @@ void Plot::ChartPanelChanged(wxChartPanel *WXUNUSED(oldPanel), wxChartPanel *WXU
 {
 	// default - do nothing
 }
+
+void Plot::FirePlotLayersNeedRedraw(int layers)
+{
+	for (std::vector<Observer*>::iterator it = observers.begin();
+		 it < observers.end(); it++) {
+		(*it)->PlotLayersNeedRedraw(this, layers);
+	}
+}
@@ -0,0 +1,507 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	rastersurface.cpp
+// Purpose: memory buffer drawing surface implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/rastersurface.h>
+#include <wx/symbol.h>
+
+#if wxUSE_GRAPHICS_CONTEXT
+#include <wx/dcgraph.h>
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+#include <math.h>
+#include <algorithm>
+
+//
+// Pixel helper functions. Pixels are 0xAARRGGBB values with
+// color components premultiplied by alpha.
+//
+
+/**
+ * Multiplies all pixel components by scale / 256.
+ */
+static inline wxUint32 ScalePixel(wxUint32 pixel, unsigned int scale)
+{
+	wxUint32 rb = (((pixel & 0x00FF00FF) * scale) >> 8) & 0x00FF00FF;
+	wxUint32 ag = (((pixel >> 8) & 0x00FF00FF) * scale) & 0xFF00FF00;
+	return rb | ag;
+}
+
+/**
+ * Draws source pixel over destination pixel.
+ */
+static inline wxUint32 BlendOver(wxUint32 dst, wxUint32 src)
+{
+	unsigned int alpha = src >> 24;
+
+	if (alpha == 255) {
+		return src;
+	}
+	if (alpha == 0) {
+		return dst;
+	}
+	return src + ScalePixel(dst, 256 - alpha - (alpha >> 7));
+}
+
+RasterDrawSurface::RasterDrawSurface(wxDC &dc, wxRect rc, bool antialias)
+: m_dc(dc)
+{
+	if (rc.width < 0 || rc.height < 0) {
+		rc.width = rc.height = 0;
+	}
+
+	m_rc = rc;
+	m_rcClip = rc;
+	m_antialias = antialias;
+
+	m_pixels.resize(rc.width * rc.height, 0);
+	m_dirty = false;
+
+	m_penColor = 0xFF000000;
+	m_penWidth = 1;
+	m_penVisible = true;
+
+	m_brushColor = 0xFFFFFFFF;
+	m_brushVisible = true;
+}
+
+RasterDrawSurface::~RasterDrawSurface()
+{
+}
+
+wxDC &RasterDrawSurface::GetDC()
+{
+	return m_dc;
+}
+
+bool RasterDrawSurface::IsAntialiased()
+{
+	return m_antialias;
+}
+
+void RasterDrawSurface::Flush()
+{
+	if (!m_dirty) {
+		return ;
+	}
+
+#if wxUSE_GRAPHICS_CONTEXT
+	// graphics bitmaps don't use GUI, so they work in worker threads
+	wxGCDC *gcdc = wxDynamicCast(&m_dc, wxGCDC);
+	if (gcdc != NULL && gcdc->GetGraphicsContext() != NULL) {
+		wxGraphicsContext *gc = gcdc->GetGraphicsContext();
+
+		wxGraphicsBitmap bitmap = gc->CreateBitmapFromImage(ToImage());
+		gc->DrawBitmap(bitmap, m_rc.x, m_rc.y, m_rc.width, m_rc.height);
+
+		Clear();
+		return ;
+	}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+	wxBitmap bitmap(ToImage());
+	m_dc.DrawBitmap(bitmap, m_rc.x, m_rc.y, true);
+
+	Clear();
+}
+
+bool RasterDrawSurface::CanDrawTo(wxDC &dc)
+{
+	double scaleX, scaleY;
+	dc.GetUserScale(&scaleX, &scaleY);
+	if (scaleX != 1 || scaleY != 1) {
+		return false;
+	}
+
+	return IsMainThread() || IsAntialiasedDC(dc);
+}
+
+void RasterDrawSurface::Clear()
+{
+	std::fill(m_pixels.begin(), m_pixels.end(), 0);
+	m_dirty = false;
+}
+
+wxImage RasterDrawSurface::ToImage()
+{
+	wxImage image(m_rc.width, m_rc.height, false);
+	image.InitAlpha();
+
+	unsigned char *data = image.GetData();
+	unsigned char *alpha = image.GetAlpha();
+
+	const size_t count = m_pixels.size();
+	for (size_t n = 0; n < count; n++) {
+		wxUint32 pixel = m_pixels[n];
+		unsigned int a = pixel >> 24;
+
+		alpha[n] = (unsigned char) a;
+		if (a == 0) {
+			data[n * 3] = data[n * 3 + 1] = data[n * 3 + 2] = 0;
+			continue;
+		}
+
+		// unpremultiply
+		data[n * 3 + 0] = (unsigned char) wxMin(255u, ((pixel >> 16) & 0xFF) * 255 / a);
+		data[n * 3 + 1] = (unsigned char) wxMin(255u, ((pixel >> 8) & 0xFF) * 255 / a);
+		data[n * 3 + 2] = (unsigned char) wxMin(255u, (pixel & 0xFF) * 255 / a);
+	}
+	return image;
+}
+
+wxUint32 RasterDrawSurface::ColourToPixel(const wxColour &color)
+{
+	unsigned int a = color.Alpha();
+
+	return (a << 24) |
+		((color.Red() * a / 255) << 16) |
+		((color.Green() * a / 255) << 8) |
+		(color.Blue() * a / 255);
+}
+
+void RasterDrawSurface::ImageToPixels(const wxImage &image, std::vector<wxUint32> &pixels)
+{
+	const wxCoord count = image.GetWidth() * image.GetHeight();
+	const unsigned char *data = image.GetData();
+	const unsigned char *alpha = image.GetAlpha();
+
+	pixels.resize(wxMax(0, count));
+	for (wxCoord n = 0; n < count; n++) {
+		unsigned int a = (alpha != NULL) ? alpha[n] : 255;
+
+		pixels[n] = (a << 24) |
+			((data[n * 3 + 0] * a / 255) << 16) |
+			((data[n * 3 + 1] * a / 255) << 8) |
+			(data[n * 3 + 2] * a / 255);
+	}
+}
+
+void RasterDrawSurface::SetClippingRect(wxRect rcClip)
+{
+	wxCoord x0 = wxMax(rcClip.x, m_rc.x);
+	wxCoord y0 = wxMax(rcClip.y, m_rc.y);
+	wxCoord x1 = wxMin(rcClip.x + rcClip.width, m_rc.x + m_rc.width);
+	wxCoord y1 = wxMin(rcClip.y + rcClip.height, m_rc.y + m_rc.height);
+
+	m_rcClip = wxRect(x0, y0, wxMax(0, x1 - x0), wxMax(0, y1 - y0));
+}
+
+void RasterDrawSurface::SetPen(const wxPen &pen)
+{
+	if (pen.IsOk() && pen.GetStyle() != wxPENSTYLE_TRANSPARENT) {
+		SetRasterPen(true, ColourToPixel(pen.GetColour()), pen.GetWidth());
+	}
+	else {
+		SetRasterPen(false, 0, 1);
+	}
+}
+
+void RasterDrawSurface::SetBrush(const wxBrush &brush)
+{
+	if (brush.IsOk() && brush.GetStyle() != wxBRUSHSTYLE_TRANSPARENT) {
+		SetRasterBrush(true, ColourToPixel(brush.GetColour()));
+	}
+	else {
+		SetRasterBrush(false, 0);
+	}
+}
+
+void RasterDrawSurface::SetRasterPen(bool visible, wxUint32 color, double width)
+{
+	m_penVisible = visible;
+	if (m_penVisible) {
+		m_penColor = color;
+		m_penWidth = wxMax(1.0, width);
+	}
+}
+
+void RasterDrawSurface::SetRasterBrush(bool visible, wxUint32 color)
+{
+	m_brushVisible = visible;
+	if (m_brushVisible) {
+		m_brushColor = color;
+	}
+}
+
+void RasterDrawSurface::BlendPixel(wxCoord x, wxCoord y, wxUint32 color, unsigned int coverage)
+{
+	if (x < m_rcClip.x || x >= m_rcClip.x + m_rcClip.width ||
+			y < m_rcClip.y || y >= m_rcClip.y + m_rcClip.height) {
+		return ;
+	}
+
+	wxUint32 &pixel = m_pixels[(y - m_rc.y) * m_rc.width + (x - m_rc.x)];
+	if (coverage < 256) {
+		color = ScalePixel(color, coverage);
+	}
+	pixel = BlendOver(pixel, color);
+}
+
+void RasterDrawSurface::FillSpan(wxCoord y, wxCoord x0, wxCoord x1, wxUint32 color)
+{
+	if (y < m_rcClip.y || y >= m_rcClip.y + m_rcClip.height) {
+		return ;
+	}
+
+	x0 = wxMax(x0, m_rcClip.x);
+	x1 = wxMin(x1, m_rcClip.x + m_rcClip.width - 1);
+	if (x0 > x1) {
+		return ;
+	}
+
+	wxUint32 *span = &m_pixels[(y - m_rc.y) * m_rc.width + (x0 - m_rc.x)];
+	const wxCoord count = x1 - x0 + 1;
+	if ((color >> 24) == 255) {
+		std::fill(span, span + count, color);
+	}
+	else {
+		for (wxCoord n = 0; n < count; n++) {
+			span[n] = BlendOver(span[n], color);
+		}
+	}
+}
+
+void RasterDrawSurface::RasterLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1, bool drawLast)
+{
+	//
+	// Line is drawn by stepping along major axis, and filling pixels across
+	// it, covered by line of pen width. For antialiasing, coverage
+	// is calculated from overlap of line and pixel.
+	//
+	wxCoord dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+	wxCoord dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+	bool steep = dy > dx;
+
+	wxCoord a0 = steep ? y0 : x0;
+	wxCoord b0 = steep ? x0 : y0;
+	wxCoord a1 = steep ? y1 : x1;
+	wxCoord b1 = steep ? x1 : y1;
+
+	wxCoord aFirst = wxMin(a0, a1);
+	wxCoord aLast = wxMax(a0, a1);
+	if (!drawLast) {
+		if (a0 == a1) {
+			return ;
+		}
+		if (a1 > a0) {
+			aLast--;
+		}
+		else {
+			aFirst++;
+		}
+	}
+
+	double gradient = (a1 != a0) ? (double) (b1 - b0) / (a1 - a0) : 0;
+	double halfWidth = m_penWidth / 2 * sqrt(1 + gradient * gradient);
+
+	// clip by major axis
+	wxCoord clipMin = steep ? m_rcClip.y : m_rcClip.x;
+	wxCoord clipMax = clipMin + (steep ? m_rcClip.height : m_rcClip.width) - 1;
+	aFirst = wxMax(aFirst, clipMin);
+	aLast = wxMin(aLast, clipMax);
+
+	// clip by minor axis, line is widened by pen to both sides
+	double bClipMin = (steep ? m_rcClip.x : m_rcClip.y) - halfWidth - 1;
+	double bClipMax = bClipMin + (steep ? m_rcClip.width : m_rcClip.height) + 2 * halfWidth + 2;
+	if (gradient == 0) {
+		if (b0 < bClipMin || b0 > bClipMax) {
+			return ;
+		}
+	}
+	else {
+		double aClip0 = a0 + (bClipMin - b0) / gradient;
+		double aClip1 = a0 + (bClipMax - b0) / gradient;
+		double aClipMin = wxMin(aClip0, aClip1);
+		double aClipMax = wxMax(aClip0, aClip1);
+
+		if (aClipMin > aLast || aClipMax < aFirst) {
+			return ;
+		}
+		if (aClipMin > aFirst) {
+			aFirst = (wxCoord) floor(aClipMin);
+		}
+		if (aClipMax < aLast) {
+			aLast = (wxCoord) ceil(aClipMax);
+		}
+	}
+
+	if (aFirst > aLast) {
+		return ;
+	}
+	m_dirty = true;
+
+	// width across line in whole pixels, when it's not antialiased
+	wxCoord solidWidth = wxMax(1, (wxCoord) floor(2 * halfWidth + 0.5));
+
+	// horizontal lines are filled by spans
+	bool wholePixels = !m_antialias || (m_penWidth == floor(m_penWidth) && ((wxCoord) m_penWidth) % 2 == 1);
+	if (!steep && b0 == b1 && wholePixels) {
+		wxCoord bFirst = (wxCoord) floor(b0 - solidWidth / 2.0 + 0.5);
+		for (wxCoord b = bFirst; b < bFirst + solidWidth; b++) {
+			FillSpan(b, aFirst, aLast, m_penColor);
+		}
+		return ;
+	}
+
+	for (wxCoord a = aFirst; a <= aLast; a++) {
+		double bCenter = b0 + (a - a0) * gradient;
+
+		if (m_antialias) {
+			double top = bCenter - halfWidth;
+			double bottom = bCenter + halfWidth;
+
+			wxCoord bFirst = (wxCoord) floor(top + 0.5);
+			wxCoord bLast = (wxCoord) floor(bottom + 0.5);
+
+			for (wxCoord b = bFirst; b <= bLast; b++) {
+				double cover = wxMin(bottom, b + 0.5) - wxMax(top, b - 0.5);
+				if (cover <= 0) {
+					continue;
+				}
+
+				unsigned int coverage = (unsigned int) (cover * 256 + 0.5);
+				coverage = wxMin(coverage, 256u);
+
+				if (steep) {
+					BlendPixel(b, a, m_penColor, coverage);
+				}
+				else {
+					BlendPixel(a, b, m_penColor, coverage);
+				}
+			}
+		}
+		else {
+			wxCoord bFirst = (wxCoord) floor(bCenter - solidWidth / 2.0 + 0.5);
+
+			if (steep) {
+				FillSpan(a, bFirst, bFirst + solidWidth - 1, m_penColor);
+			}
+			else {
+				for (wxCoord b = bFirst; b < bFirst + solidWidth; b++) {
+					BlendPixel(a, b, m_penColor, 256);
+				}
+			}
+		}
+	}
+}
+
+void RasterDrawSurface::DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1)
+{
+	if (m_penVisible) {
+		// last point is not drawn, like wxDC::DrawLine does
+		RasterLine(x0, y0, x1, y1, false);
+	}
+}
+
+void RasterDrawSurface::DrawLines(size_t count, const wxPoint *points)
+{
+	if (!m_penVisible) {
+		return ;
+	}
+
+	for (size_t n = 1; n < count; n++) {
+		// don't draw shared points twice, it's visible with antialiasing
+		RasterLine(points[n - 1].x, points[n - 1].y, points[n].x, points[n].y, n == count - 1);
+	}
+}
+
+void RasterDrawSurface::DrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height)
+{
+	if (width < 0) {
+		x += width;
+		width = -width;
+	}
+	if (height < 0) {
+		y += height;
+		height = -height;
+	}
+	if (width == 0 || height == 0) {
+		return ;
+	}
+
+	m_dirty = true;
+
+	if (m_brushVisible) {
+		// interior
+		wxCoord border = m_penVisible ? 1 : 0;
+		for (wxCoord yFill = y + border; yFill < y + height - border; yFill++) {
+			FillSpan(yFill, x + border, x + width - 1 - border, m_brushColor);
+		}
+	}
+
+	if (m_penVisible) {
+		FillSpan(y, x, x + width - 1, m_penColor);
+		if (height > 1) {
+			FillSpan(y + height - 1, x, x + width - 1, m_penColor);
+		}
+
+		for (wxCoord yLine = y + 1; yLine < y + height - 1; yLine++) {
+			BlendPixel(x, yLine, m_penColor, 256);
+			if (width > 1) {
+				BlendPixel(x + width - 1, yLine, m_penColor, 256);
+			}
+		}
+	}
+}
+
+void RasterDrawSurface::DrawSymbols(Symbol *symbol, const wxPoint *points, size_t count, wxColour color)
+{
+	if (count == 0) {
+		return ;
+	}
+
+	if (!IsMainThread()) {
+		// sprites can't be created here, draw symbols over buffer
+		Flush();
+		symbol->DrawSymbols(m_dc, points, count, color);
+		return ;
+	}
+
+	wxPoint center;
+	const wxImage &image = symbol->GetSpriteImage(color, m_antialias, center);
+
+	const wxCoord width = image.GetWidth();
+	const wxCoord height = image.GetHeight();
+	if (width <= 0 || height <= 0) {
+		return ;
+	}
+
+	ImageToPixels(image, m_spritePixels);
+	DrawSprite(&m_spritePixels[0], width, height, center, points, count);
+}
+
+void RasterDrawSurface::DrawSprite(const wxUint32 *pixels, wxCoord width, wxCoord height, wxPoint center, const wxPoint *points, size_t count)
+{
+	if (count == 0 || width <= 0 || height <= 0) {
+		return ;
+	}
+
+	m_dirty = true;
+
+	const wxCoord clipX1 = m_rcClip.x + m_rcClip.width;
+	const wxCoord clipY1 = m_rcClip.y + m_rcClip.height;
+
+	for (size_t n = 0; n < count; n++) {
+		wxCoord left = points[n].x - center.x;
+		wxCoord top = points[n].y - center.y;
+
+		wxCoord x0 = wxMax(left, m_rcClip.x);
+		wxCoord y0 = wxMax(top, m_rcClip.y);
+		wxCoord x1 = wxMin(left + width, clipX1);
+		wxCoord y1 = wxMin(top + height, clipY1);
+
+		for (wxCoord y = y0; y < y1; y++) {
+			const wxUint32 *src = &pixels[(y - top) * width + (x0 - left)];
+			wxUint32 *dst = &m_pixels[(y - m_rc.y) * m_rc.width + (x0 - m_rc.x)];
+
+			for (wxCoord i = 0; i < x1 - x0; i++) {
+				dst[i] = BlendOver(dst[i], src[i]);
+			}
+		}
+	}
+}
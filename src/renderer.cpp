@@ -47,12 +47,30 @@ Symbol *Renderer::GetSerieSymbol(size_t serie)
 	return m_serieSymbols[serie];
 }
 
+void Renderer::ResolveSerieStyle(size_t serie, SerieStyle &style)
+{
+	style.colour = GetSerieColour(serie);
+	style.symbol = GetSerieSymbol(serie);
+	style.pen = wxPen(style.colour, 1, wxPENSTYLE_SOLID);
+	style.brush = wxBrush(style.colour);
+}
+
+void Renderer::ResolveSerieStyles(size_t count)
+{
+	size_t first = m_serieStyles.size();
+
+	m_serieStyles.resize(count);
+	for (size_t serie = first; serie < count; serie++) {
+		ResolveSerieStyle(serie, m_serieStyles[serie]);
+	}
+}
+
 void Renderer::DrawLegendSymbol(wxDC &dc, wxRect rcSymbol, size_t serie)
 {
 	wxColour colour = GetSerieColour(serie);
 
-	dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(colour));
-	dc.SetPen(*wxThePenList->FindOrCreatePen(colour, 1, wxPENSTYLE_SOLID));
+	dc.SetBrush(wxBrush(colour));
+	dc.SetPen(wxPen(colour, 1, wxPENSTYLE_SOLID));
 
 	dc.DrawRectangle(rcSymbol);
 }
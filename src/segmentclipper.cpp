@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	segmentclipper.cpp
+// Purpose: line segments clipper implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/segmentclipper.h>
+
+// point outcodes
+enum {
+	OUT_LEFT = 1,
+	OUT_RIGHT = 2,
+	OUT_TOP = 4,
+	OUT_BOTTOM = 8,
+};
+
+SegmentClipper::SegmentClipper(const AxisTransform &horizTransform, const AxisTransform &vertTransform)
+: m_horizTransform(horizTransform), m_vertTransform(vertTransform)
+{
+	wxCoord minCoord, maxCoord;
+
+	horizTransform.GetCoordRange(minCoord, maxCoord);
+	m_xMin = minCoord;
+	m_xMax = maxCoord;
+
+	vertTransform.GetCoordRange(minCoord, maxCoord);
+	m_yMin = minCoord;
+	m_yMax = maxCoord;
+}
+
+SegmentClipper::~SegmentClipper()
+{
+}
+
+void SegmentClipper::CalcCodes(const double *xValues, const double *yValues, size_t count)
+{
+	m_xCoords.resize(count);
+	m_yCoords.resize(count);
+	m_codes.resize(count);
+
+	m_horizTransform.ToGraphics(xValues, &m_xCoords[0], count);
+	m_vertTransform.ToGraphics(yValues, &m_yCoords[0], count);
+
+	const double *xs = &m_xCoords[0];
+	const double *ys = &m_yCoords[0];
+	unsigned char *codes = &m_codes[0];
+
+	// No branches, so loop is vectorized by compiler.
+	// Comparisons are negated to mark NaN coordinates outside.
+	for (size_t n = 0; n < count; n++) {
+		codes[n] = (unsigned char) (
+				(!(xs[n] >= m_xMin) ? OUT_LEFT : 0) |
+				(!(xs[n] <= m_xMax) ? OUT_RIGHT : 0) |
+				(!(ys[n] >= m_yMin) ? OUT_TOP : 0) |
+				(!(ys[n] <= m_yMax) ? OUT_BOTTOM : 0));
+	}
+}
+
+void SegmentClipper::ClipPolyline(const double *xValues, const double *yValues, size_t count, std::vector<wxPoint> &segments)
+{
+	if (count < 2) {
+		return ;
+	}
+
+	CalcCodes(xValues, yValues, count);
+
+	const double *xs = &m_xCoords[0];
+	const double *ys = &m_yCoords[0];
+	const unsigned char *codes = &m_codes[0];
+
+	for (size_t n = 0; n < count - 1; n++) {
+		if ((codes[n] & codes[n + 1]) != 0) {
+			// both points are on the same outer side
+			continue;
+		}
+
+		double x0 = xs[n];
+		double y0 = ys[n];
+		double x1 = xs[n + 1];
+		double y1 = ys[n + 1];
+
+		if ((codes[n] | codes[n + 1]) != 0 && !ClipSegment(x0, y0, x1, y1, true)) {
+			continue;
+		}
+
+		segments.push_back(wxPoint((wxCoord) x0, (wxCoord) y0));
+		segments.push_back(wxPoint((wxCoord) x1, (wxCoord) y1));
+	}
+}
+
+void SegmentClipper::ClipArea(const double *xValues, const double *yValues, size_t count, std::vector<wxPoint> &segments)
+{
+	if (count < 2) {
+		return ;
+	}
+
+	CalcCodes(xValues, yValues, count);
+
+	const double *xs = &m_xCoords[0];
+	const double *ys = &m_yCoords[0];
+	const unsigned char *codes = &m_codes[0];
+	const unsigned char horizCodes = OUT_LEFT | OUT_RIGHT;
+
+	for (size_t n = 0; n < count - 1; n++) {
+		if ((codes[n] & codes[n + 1] & horizCodes) != 0) {
+			// both points are on the same side, left or right
+			continue;
+		}
+
+		double x0 = xs[n];
+		double y0 = ys[n];
+		double x1 = xs[n + 1];
+		double y1 = ys[n + 1];
+
+		if (((codes[n] | codes[n + 1]) & horizCodes) != 0 && !ClipSegment(x0, y0, x1, y1, false)) {
+			continue;
+		}
+
+		AddClampedSegment(x0, y0, x1, y1, segments);
+	}
+}
+
+void SegmentClipper::AddClampedSegment(double x0, double y0, double x1, double y1, std::vector<wxPoint> &segments)
+{
+	// NaN or infinite coordinates can't be clamped
+	if ((x0 - x0) != 0 || (y0 - y0) != 0 || (x1 - x1) != 0 || (y1 - y1) != 0) {
+		return ;
+	}
+
+	//
+	// Segment is split where it crosses top or bottom edge, so each part
+	// is entirely inside, above or below rectangle, and then clamped.
+	//
+	double ts[4];
+	size_t tCount = 0;
+
+	ts[tCount++] = 0;
+
+	const double edges[2] = { m_yMin, m_yMax };
+	for (int i = 0; i < 2; i++) {
+		if ((y0 - edges[i]) * (y1 - edges[i]) < 0) {
+			ts[tCount++] = (edges[i] - y0) / (y1 - y0);
+		}
+	}
+	if (tCount == 3 && ts[1] > ts[2]) {
+		double t = ts[1];
+		ts[1] = ts[2];
+		ts[2] = t;
+	}
+
+	ts[tCount++] = 1;
+
+	const double dx = x1 - x0;
+	const double dy = y1 - y0;
+
+	for (size_t i = 0; i < tCount - 1; i++) {
+		double xa = x0 + ts[i] * dx;
+		double ya = y0 + ts[i] * dy;
+		double xb = x0 + ts[i + 1] * dx;
+		double yb = y0 + ts[i + 1] * dy;
+
+		ya = wxMax(m_yMin, wxMin(ya, m_yMax));
+		yb = wxMax(m_yMin, wxMin(yb, m_yMax));
+
+		segments.push_back(wxPoint((wxCoord) xa, (wxCoord) ya));
+		segments.push_back(wxPoint((wxCoord) xb, (wxCoord) yb));
+	}
+}
+
+bool SegmentClipper::ClipSegment(double &x0, double &y0, double &x1, double &y1, bool clipVert)
+{
+	// NaN or infinite coordinates can't be clipped
+	if ((x0 - x0) != 0 || (y0 - y0) != 0 || (x1 - x1) != 0 || (y1 - y1) != 0) {
+		return false;
+	}
+
+	double dx = x1 - x0;
+	double dy = y1 - y0;
+
+	// segment is x0 + t * dx, y0 + t * dy, where t is in [t0, t1]
+	double t0 = 0;
+	double t1 = 1;
+
+	double p[4] = { -dx, dx, -dy, dy };
+	double q[4] = { x0 - m_xMin, m_xMax - x0, y0 - m_yMin, m_yMax - y0 };
+
+	// left and right edges go first, top and bottom are optional
+	const int edgeCount = clipVert ? 4 : 2;
+
+	for (int i = 0; i < edgeCount; i++) {
+		if (p[i] == 0) {
+			if (q[i] < 0) {
+				// parallel to edge and outside
+				return false;
+			}
+			continue;
+		}
+
+		double t = q[i] / p[i];
+		if (p[i] < 0) {
+			// entering
+			if (t > t1) {
+				return false;
+			}
+			if (t > t0) {
+				t0 = t;
+			}
+		}
+		else {
+			// leaving
+			if (t < t0) {
+				return false;
+			}
+			if (t < t1) {
+				t1 = t;
+			}
+		}
+	}
+
+	if (t1 < 1) {
+		x1 = x0 + t1 * dx;
+		y1 = y0 + t1 * dy;
+	}
+	if (t0 > 0) {
+		x0 = x0 + t0 * dx;
+		y0 = y0 + t0 * dy;
+	}
+	return true;
+}
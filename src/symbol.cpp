@@ -8,6 +8,17 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include <wx/symbol.h>
+#include <wx/drawsurface.h>
+
+#if wxUSE_GRAPHICS_CONTEXT
+#include <wx/dcgraph.h>
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+// maximal cached sprites count per symbol
+static const size_t maxSprites = 16;
+
+// space around symbol extent in sprite, for antialiased edges
+static const wxCoord spriteMargin = 2;
 
 Symbol::Symbol()
 {
@@ -17,12 +28,207 @@ Symbol::~Symbol()
 {
 }
 
+void Symbol::DrawSymbols(wxDC &dc, const wxPoint *points, size_t count, wxColour color)
+{
+	if (count == 0) {
+		return ;
+	}
+
+#if wxUSE_GRAPHICS_CONTEXT
+	wxGCDC *pathDC = wxDynamicCast(&dc, wxGCDC);
+	if (pathDC != NULL && pathDC->GetGraphicsContext() != NULL) {
+		// draw all symbols as one graphics path, if symbol supports it
+		wxGraphicsContext *gc = pathDC->GetGraphicsContext();
+		wxGraphicsPath path = gc->CreatePath();
+
+		if (AddToPath(path, points[0].x, points[0].y)) {
+			for (size_t n = 1; n < count; n++) {
+				AddToPath(path, points[n].x, points[n].y);
+			}
+
+			dc.SetPen(wxPen(color, 1, wxPENSTYLE_SOLID));
+			dc.SetBrush(wxBrush(color));
+			gc->DrawPath(path, wxWINDING_RULE);
+			return ;
+		}
+	}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+	if (!IsMainThread()) {
+		// sprites are created using bitmaps, that can't be used here,
+		// so symbols are drawn directly (Draw must not call DrawSymbols)
+		for (size_t n = 0; n < count; n++) {
+			Draw(dc, points[n].x, points[n].y, color);
+		}
+		return ;
+	}
+
+#if wxUSE_GRAPHICS_CONTEXT
+	wxGCDC *gcdc = wxDynamicCast(&dc, wxGCDC);
+	if (gcdc != NULL && gcdc->GetGraphicsContext() != NULL) {
+		SymbolSprite &sprite = GetSprite(color, true);
+		wxGraphicsContext *gc = gcdc->GetGraphicsContext();
+
+		// convert sprite to native graphics bitmap only once
+		wxGraphicsBitmap bitmap = gc->CreateBitmap(sprite.bitmap);
+		wxCoord width = sprite.bitmap.GetWidth();
+		wxCoord height = sprite.bitmap.GetHeight();
+
+		for (size_t n = 0; n < count; n++) {
+			gc->DrawBitmap(bitmap, points[n].x - sprite.center.x, points[n].y - sprite.center.y, width, height);
+		}
+		return ;
+	}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+	SymbolSprite &sprite = GetSprite(color, false);
+	wxCoord width = sprite.bitmap.GetWidth();
+	wxCoord height = sprite.bitmap.GetHeight();
+
+	wxMemoryDC spriteDC(sprite.bitmap);
+	for (size_t n = 0; n < count; n++) {
+		dc.Blit(points[n].x - sprite.center.x, points[n].y - sprite.center.y, width, height,
+				&spriteDC, 0, 0, wxCOPY, true);
+	}
+}
+
+#if wxUSE_GRAPHICS_CONTEXT
+bool Symbol::AddToPath(wxGraphicsPath &WXUNUSED(path), wxCoord WXUNUSED(x), wxCoord WXUNUSED(y))
+{
+	return false;
+}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+Symbol::SymbolSprite &Symbol::GetSprite(wxColour color, bool antialias)
+{
+	wxSize size = GetExtent();
+
+	for (size_t n = 0; n < m_sprites.size(); n++) {
+		SymbolSprite &sprite = m_sprites[n];
+
+		if (sprite.color == color && sprite.size == size && sprite.antialias == antialias) {
+			return sprite;
+		}
+	}
+
+	if (m_sprites.size() >= maxSprites) {
+		// drop oldest sprite
+		m_sprites.erase(m_sprites.begin());
+	}
+
+	SymbolSprite sprite;
+	sprite.color = color;
+	sprite.size = size;
+	sprite.antialias = antialias;
+	sprite.bitmap = CreateSprite(color, antialias, sprite.center);
+
+	m_sprites.push_back(sprite);
+	return m_sprites.back();
+}
+
+const wxImage &Symbol::GetSpriteImage(wxColour color, bool antialias, wxPoint &center)
+{
+	SymbolSprite &sprite = GetSprite(color, antialias);
+
+	if (!sprite.image.IsOk()) {
+		sprite.image = sprite.bitmap.ConvertToImage();
+		if (!sprite.image.HasAlpha()) {
+			// converts mask to alpha
+			sprite.image.InitAlpha();
+		}
+	}
+
+	center = sprite.center;
+	return sprite.image;
+}
+
+void Symbol::ClearSprites()
+{
+	m_sprites.clear();
+}
+
+wxBitmap Symbol::CreateSprite(wxColour color, bool antialias, wxPoint &center)
+{
+	wxSize extent = GetExtent();
+	wxCoord width = extent.x + 2 * spriteMargin;
+	wxCoord height = extent.y + 2 * spriteMargin;
+
+	center = wxPoint(width / 2, height / 2);
+
+#if wxUSE_GRAPHICS_CONTEXT
+	if (antialias) {
+		//
+		// Draw symbol on black and white backgrounds, and calculate
+		// alpha from difference between them.
+		//
+		wxBitmap blackBitmap(width, height);
+		wxBitmap whiteBitmap(width, height);
+
+		wxMemoryDC mdc;
+		wxBitmap *bitmaps[] = { &blackBitmap, &whiteBitmap };
+		for (size_t n = 0; n < WXSIZEOF(bitmaps); n++) {
+			mdc.SelectObject(*bitmaps[n]);
+			mdc.SetBackground((n == 0) ? *wxBLACK_BRUSH : *wxWHITE_BRUSH);
+			mdc.Clear();
+			{
+				wxGCDC gdc(mdc);
+				Draw(gdc, center.x, center.y, color);
+			}
+			mdc.SelectObject(wxNullBitmap);
+		}
+
+		wxImage blackImage = blackBitmap.ConvertToImage();
+		wxImage whiteImage = whiteBitmap.ConvertToImage();
+
+		wxImage image(width, height, false);
+		image.InitAlpha();
+
+		const unsigned char *black = blackImage.GetData();
+		const unsigned char *white = whiteImage.GetData();
+		unsigned char *data = image.GetData();
+		unsigned char *alpha = image.GetAlpha();
+
+		for (int n = 0; n < width * height; n++) {
+			// white - black = 255 - alpha for each channel
+			int diff = ((int) white[n * 3] - black[n * 3] +
+					(int) white[n * 3 + 1] - black[n * 3 + 1] +
+					(int) white[n * 3 + 2] - black[n * 3 + 2]) / 3;
+			int a = wxMax(0, wxMin(255, 255 - diff));
+
+			alpha[n] = (unsigned char) a;
+			for (int c = 0; c < 3; c++) {
+				// black background gives colour premultiplied by alpha
+				data[n * 3 + c] = (a != 0) ? (unsigned char) wxMin(255, black[n * 3 + c] * 255 / a) : 0;
+			}
+		}
+		return wxBitmap(image);
+	}
+#else
+	wxUnusedVar(antialias);
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+	// use colour, that differs from symbol colour as mask
+	wxColour maskColour = (color == *wxBLACK) ? *wxWHITE : *wxBLACK;
+
+	wxBitmap bitmap(width, height);
+
+	wxMemoryDC mdc;
+	mdc.SelectObject(bitmap);
+	mdc.SetBackground(wxBrush(maskColour));
+	mdc.Clear();
+	Draw(mdc, center.x, center.y, color);
+	mdc.SelectObject(wxNullBitmap);
+
+	bitmap.SetMask(new wxMask(bitmap, maskColour));
+	return bitmap;
+}
+
 MaskedSymbol::MaskedSymbol(const char **maskData, wxCoord size)
 {
-	m_maskBmp = wxBitmap(maskData);
+	// mask is kept as image, because bitmaps can't be used
+	// from worker threads
+	m_maskImage = wxImage(maskData);
 	m_size = size;
-
-	m_initialized = false;
 }
 
 MaskedSymbol::~MaskedSymbol()
@@ -36,17 +242,47 @@ wxSize MaskedSymbol::GetExtent()
 
 void MaskedSymbol::Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color)
 {
-	wxImage tmpImage = m_maskBmp.ConvertToImage();
-	tmpImage.Replace((unsigned char) -1, (unsigned char) -1, (unsigned char)  -1, color.Red(), color.Green(), color.Blue());
-	tmpImage.Rescale(m_size, m_size, wxIMAGE_QUALITY_HIGH);
+	wxImage image = CreateImage(color);
 
-	m_symbolBitmap = wxBitmap(tmpImage);
-	m_symbolBitmap.SetMask(new wxMask(wxBitmap(tmpImage), *wxBLACK));
+	wxCoord left = x - m_size / 2;
+	wxCoord top = y - m_size / 2;
 
-	wxSize extent = GetExtent();
-	wxMemoryDC symbolDC(m_symbolBitmap);
+#if wxUSE_GRAPHICS_CONTEXT
+	wxGCDC *gcdc = wxDynamicCast(&dc, wxGCDC);
+	if (gcdc != NULL && gcdc->GetGraphicsContext() != NULL) {
+		// graphics bitmap is created from image without wxBitmap,
+		// so it can be drawn from any thread
+		wxGraphicsContext *gc = gcdc->GetGraphicsContext();
 
-	dc.Blit(x - extent.x / 2, y - extent.y / 2, extent.x, extent.y, &symbolDC, 0, 0, wxCOPY, true);
+		image.InitAlpha(); // converts mask to alpha
+		wxGraphicsBitmap bitmap = gc->CreateBitmapFromImage(image);
+		gc->DrawBitmap(bitmap, left, top, m_size, m_size);
+		return ;
+	}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+	wxCHECK_RET(IsMainThread(), wxT("MaskedSymbol::Draw: only graphics context can be used from worker thread"));
+
+	dc.DrawBitmap(wxBitmap(image), left, top, true);
+}
+
+wxBitmap MaskedSymbol::CreateSprite(wxColour color, bool WXUNUSED(antialias), wxPoint &center)
+{
+	center = wxPoint(m_size / 2, m_size / 2);
+
+	// bitmap gets mask from image
+	return wxBitmap(CreateImage(color));
+}
+
+wxImage MaskedSymbol::CreateImage(wxColour color)
+{
+	// deep copy, because reference counter of shared image
+	// data isn't thread safe
+	wxImage image = m_maskImage.Copy();
+	image.Replace((unsigned char) -1, (unsigned char) -1, (unsigned char)  -1, color.Red(), color.Green(), color.Blue());
+	image.Rescale(m_size, m_size, wxIMAGE_QUALITY_HIGH);
+	image.SetMaskColour(0, 0, 0);
+	return image;
 }
 
 ShapeSymbol::ShapeSymbol(wxCoord size)
@@ -74,12 +310,20 @@ CircleSymbol::~CircleSymbol()
 
 void CircleSymbol::Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color)
 {
-	dc.SetPen(*wxThePenList->FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
-	dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(color));
+	dc.SetPen(wxPen(color, 1, wxPENSTYLE_SOLID));
+	dc.SetBrush(wxBrush(color));
 
 	dc.DrawCircle(x, y, m_size / 2);
 }
 
+#if wxUSE_GRAPHICS_CONTEXT
+bool CircleSymbol::AddToPath(wxGraphicsPath &path, wxCoord x, wxCoord y)
+{
+	path.AddCircle(x, y, m_size / 2);
+	return true;
+}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
 
 SquareSymbol::SquareSymbol(wxCoord size)
 : ShapeSymbol(size)
@@ -92,12 +336,20 @@ SquareSymbol::~SquareSymbol()
 
 void SquareSymbol::Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color)
 {
-	dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(color));
-	dc.SetPen(*wxThePenList->FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
+	dc.SetBrush(wxBrush(color));
+	dc.SetPen(wxPen(color, 1, wxPENSTYLE_SOLID));
 
 	dc.DrawRectangle(x - m_size / 2, y - m_size / 2, m_size, m_size);
 }
 
+#if wxUSE_GRAPHICS_CONTEXT
+bool SquareSymbol::AddToPath(wxGraphicsPath &path, wxCoord x, wxCoord y)
+{
+	path.AddRectangle(x - m_size / 2, y - m_size / 2, m_size, m_size);
+	return true;
+}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
 CrossSymbol::CrossSymbol(wxCoord size)
 : ShapeSymbol(size)
 {
@@ -109,12 +361,23 @@ CrossSymbol::~CrossSymbol()
 
 void CrossSymbol::Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color)
 {
-	dc.SetPen(*wxThePenList->FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
+	dc.SetPen(wxPen(color, 1, wxPENSTYLE_SOLID));
 
 	dc.DrawLine(x - m_size / 2, y, x + m_size / 2, y);
 	dc.DrawLine(x, y - m_size / 2, x, y + m_size / 2);
 }
 
+#if wxUSE_GRAPHICS_CONTEXT
+bool CrossSymbol::AddToPath(wxGraphicsPath &path, wxCoord x, wxCoord y)
+{
+	path.MoveToPoint(x - m_size / 2, y);
+	path.AddLineToPoint(x + m_size / 2, y);
+	path.MoveToPoint(x, y - m_size / 2);
+	path.AddLineToPoint(x, y + m_size / 2);
+	return true;
+}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
 TriangleSymbol::TriangleSymbol(wxCoord size)
 : ShapeSymbol(size)
 {
@@ -126,18 +389,36 @@ TriangleSymbol::~TriangleSymbol()
 
 void TriangleSymbol::Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color)
 {
-	dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(color));
-	dc.SetPen(*wxThePenList->FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
+	dc.SetBrush(wxBrush(color));
+	dc.SetPen(wxPen(color, 1, wxPENSTYLE_SOLID));
+
+	wxPoint pts[3];
+	GetPoints(x, y, pts);
+
+	dc.DrawPolygon(3, pts);
+}
+
+#if wxUSE_GRAPHICS_CONTEXT
+bool TriangleSymbol::AddToPath(wxGraphicsPath &path, wxCoord x, wxCoord y)
+{
+	wxPoint pts[3];
+	GetPoints(x, y, pts);
+
+	path.MoveToPoint(pts[0].x, pts[0].y);
+	path.AddLineToPoint(pts[1].x, pts[1].y);
+	path.AddLineToPoint(pts[2].x, pts[2].y);
+	path.CloseSubpath();
+	return true;
+}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
 
+void TriangleSymbol::GetPoints(wxCoord x, wxCoord y, wxPoint *pts)
+{
 	const double COS_30 = 0.866158094;
 	const double SIN_30 = 0.5;
 
 	double r = m_size / 2;
-	wxPoint pts[] = {
-		wxPoint(x, (wxCoord) ( y - r)),
-		wxPoint((wxCoord) (x + r * COS_30), (wxCoord) (y + r * SIN_30)),
-		wxPoint((wxCoord) (x - r * COS_30), (wxCoord) (y + r * SIN_30)),
-	};
-
-	dc.DrawPolygon(3, pts);
+	pts[0] = wxPoint(x, (wxCoord) ( y - r));
+	pts[1] = wxPoint((wxCoord) (x + r * COS_30), (wxCoord) (y + r * SIN_30));
+	pts[2] = wxPoint((wxCoord) (x - r * COS_30), (wxCoord) (y + r * SIN_30));
 }
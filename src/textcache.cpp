@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	textcache.cpp
+// Purpose: text extent cache implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/textcache.h>
+#include <wx/drawsurface.h>
+
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// created on load, so it's safe to get it from several threads
+static TextExtentCache s_sharedCache;
+
+TextExtentCache::TextExtentCache(size_t capacity)
+{
+	m_count = 0;
+	m_capacity = capacity;
+}
+
+TextExtentCache::~TextExtentCache()
+{
+}
+
+TextExtentCache *TextExtentCache::Get()
+{
+	return &s_sharedCache;
+}
+
+wxSize TextExtentCache::GetTextExtent(wxDC &dc, const wxString &text, double angle)
+{
+	return GetExtent(dc, text, angle, false);
+}
+
+wxSize TextExtentCache::GetMultiLineTextExtent(wxDC &dc, const wxString &text)
+{
+	return GetExtent(dc, text, 0, true);
+}
+
+void TextExtentCache::SetCapacity(size_t capacity)
+{
+#if wxUSE_THREADS
+	wxCriticalSectionLocker locker(m_lock);
+#endif
+
+	m_capacity = capacity;
+	Trim();
+}
+
+void TextExtentCache::Clear()
+{
+#if wxUSE_THREADS
+	wxCriticalSectionLocker locker(m_lock);
+#endif
+
+	m_entries.clear();
+	m_index.clear();
+	m_count = 0;
+}
+
+wxSize TextExtentCache::GetExtent(wxDC &dc, const wxString &text, double angle, bool multiLine)
+{
+	if (text.IsEmpty()) {
+		return wxSize(0, 0);
+	}
+
+	// text on graphics contexts and devices with other resolution
+	// (printers) has different extents
+	wxSize ppi = dc.GetPPI();
+
+	wxString key;
+	key.Printf(wxT("%s|%d|%d|%d|%g|%d|"), GetFontKey(dc.GetFont()).c_str(),
+			ppi.x, ppi.y, (int) IsAntialiasedDC(dc), angle, (int) multiLine);
+	key += text;
+
+	{
+#if wxUSE_THREADS
+		wxCriticalSectionLocker locker(m_lock);
+#endif
+
+		EntryMap::iterator it = m_index.find(key);
+		if (it != m_index.end()) {
+			// move to front, as most recently used
+			m_entries.splice(m_entries.begin(), m_entries, it->second);
+			return it->second->extent;
+		}
+	}
+
+	// measure outside of lock, it's slow
+	wxSize extent = multiLine ? dc.GetMultiLineTextExtent(text) : dc.GetTextExtent(text);
+
+	if (angle != 0) {
+		double rad = angle * M_PI / 180;
+		double c = fabs(cos(rad));
+		double s = fabs(sin(rad));
+
+		extent = wxSize((wxCoord) ceil(extent.x * c + extent.y * s),
+				(wxCoord) ceil(extent.x * s + extent.y * c));
+	}
+
+#if wxUSE_THREADS
+	wxCriticalSectionLocker locker(m_lock);
+#endif
+
+	if (m_capacity != 0 && m_index.find(key) == m_index.end()) {
+		Entry entry;
+		entry.key = key;
+		entry.extent = extent;
+
+		m_entries.push_front(entry);
+		m_index[key] = m_entries.begin();
+		m_count++;
+		Trim();
+	}
+	return extent;
+}
+
+wxString TextExtentCache::GetFontKey(const wxFont &font)
+{
+	if (!font.IsOk()) {
+		return wxT("-");
+	}
+
+	// key is built from font attributes, font isn't copied, because
+	// reference counter of font data isn't thread safe
+	wxString key;
+	key.Printf(wxT("%d|%d|%d|%d|%d|%s"), font.GetPointSize(), (int) font.GetFamily(),
+			(int) font.GetStyle(), (int) font.GetWeight(), (int) font.GetUnderlined(),
+			font.GetFaceName().c_str());
+	return key;
+}
+
+void TextExtentCache::Trim()
+{
+	// list size isn't constant time, so count is kept
+	while (m_count > m_capacity) {
+		m_index.erase(m_entries.back().key);
+		m_entries.pop_back();
+		m_count--;
+	}
+}
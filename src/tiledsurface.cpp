@@ -0,0 +1,270 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	tiledsurface.cpp
+// Purpose: multithreaded tiled drawing surface implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/tiledsurface.h>
+#include <wx/parallel.h>
+#include <wx/symbol.h>
+
+/**
+ * Rasterizes tiles of surface.
+ * Internal class, don't use from programs.
+ */
+class TileRasterTask : public ParallelTask
+{
+public:
+	TileRasterTask(TiledRasterDrawSurface &surface)
+	: m_surface(surface)
+	{
+	}
+
+	virtual ~TileRasterTask()
+	{
+	}
+
+	virtual void Run(size_t first, size_t last, size_t WXUNUSED(worker))
+	{
+		for (size_t tile = first; tile < last; tile++) {
+			m_surface.RasterTile(tile);
+		}
+	}
+
+private:
+	TiledRasterDrawSurface &m_surface;
+};
+
+TiledRasterDrawSurface::TiledRasterDrawSurface(wxDC &dc, wxRect rc, bool antialias, size_t tileCount)
+: m_dc(dc)
+{
+	if (rc.width < 0 || rc.height < 0) {
+		rc.width = rc.height = 0;
+	}
+
+	m_rc = rc;
+	m_antialias = antialias;
+
+	if (tileCount == 0) {
+		tileCount = GetParallelWorkerCount();
+	}
+	tileCount = wxMin(tileCount, (size_t) wxMax(1, rc.height));
+
+	// split rectangle to horizontal tiles of equal height
+	for (size_t n = 0; n < tileCount; n++) {
+		wxCoord top = rc.y + (wxCoord) (rc.height * n / tileCount);
+		wxCoord bottom = rc.y + (wxCoord) (rc.height * (n + 1) / tileCount);
+
+		m_tiles.push_back(new RasterDrawSurface(dc, wxRect(rc.x, top, rc.width, bottom - top), antialias));
+	}
+}
+
+TiledRasterDrawSurface::~TiledRasterDrawSurface()
+{
+	for (size_t n = 0; n < m_tiles.size(); n++) {
+		delete m_tiles[n];
+	}
+}
+
+wxDC &TiledRasterDrawSurface::GetDC()
+{
+	return m_dc;
+}
+
+bool TiledRasterDrawSurface::IsAntialiased()
+{
+	return m_antialias;
+}
+
+void TiledRasterDrawSurface::Flush()
+{
+	if (m_commands.size() == 0) {
+		return ;
+	}
+
+	if (IsCancelled()) {
+		// drawing result will not be used
+		m_commands.clear();
+		m_points.clear();
+		return ;
+	}
+
+	TileRasterTask task(*this);
+	ParallelFor(task, m_tiles.size(), 1);
+
+	// tiles don't overlap, draw them in calling thread
+	for (size_t n = 0; n < m_tiles.size(); n++) {
+		m_tiles[n]->Flush();
+	}
+
+	m_commands.clear();
+	m_points.clear();
+}
+
+TiledRasterDrawSurface::Command &TiledRasterDrawSurface::AddCommand(CommandType type)
+{
+	m_commands.push_back(Command());
+
+	Command &cmd = m_commands.back();
+	cmd.type = type;
+	cmd.x0 = cmd.y0 = cmd.x1 = cmd.y1 = 0;
+	cmd.color = 0;
+	cmd.width = 1;
+	cmd.visible = true;
+	cmd.first = cmd.count = 0;
+	cmd.sprite = 0;
+	return cmd;
+}
+
+void TiledRasterDrawSurface::SetPen(const wxPen &pen)
+{
+	Command &cmd = AddCommand(CMD_PEN);
+
+	cmd.visible = pen.IsOk() && pen.GetStyle() != wxPENSTYLE_TRANSPARENT;
+	if (cmd.visible) {
+		cmd.color = RasterDrawSurface::ColourToPixel(pen.GetColour());
+		cmd.width = pen.GetWidth();
+	}
+}
+
+void TiledRasterDrawSurface::SetBrush(const wxBrush &brush)
+{
+	Command &cmd = AddCommand(CMD_BRUSH);
+
+	cmd.visible = brush.IsOk() && brush.GetStyle() != wxBRUSHSTYLE_TRANSPARENT;
+	if (cmd.visible) {
+		cmd.color = RasterDrawSurface::ColourToPixel(brush.GetColour());
+	}
+}
+
+void TiledRasterDrawSurface::DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1)
+{
+	Command &cmd = AddCommand(CMD_LINE);
+
+	cmd.x0 = x0;
+	cmd.y0 = y0;
+	cmd.x1 = x1;
+	cmd.y1 = y1;
+}
+
+void TiledRasterDrawSurface::DrawLines(size_t count, const wxPoint *points)
+{
+	if (count == 0) {
+		return ;
+	}
+
+	Command &cmd = AddCommand(CMD_LINES);
+
+	cmd.first = m_points.size();
+	cmd.count = count;
+	m_points.insert(m_points.end(), points, points + count);
+}
+
+void TiledRasterDrawSurface::DrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height)
+{
+	Command &cmd = AddCommand(CMD_RECTANGLE);
+
+	cmd.x0 = x;
+	cmd.y0 = y;
+	cmd.x1 = width;
+	cmd.y1 = height;
+}
+
+void TiledRasterDrawSurface::DrawSymbols(Symbol *symbol, const wxPoint *points, size_t count, wxColour color)
+{
+	if (count == 0) {
+		return ;
+	}
+
+	if (!IsMainThread()) {
+		// sprites can't be created here, draw symbols over tiles
+		Flush();
+		symbol->DrawSymbols(m_dc, points, count, color);
+		return ;
+	}
+
+	size_t sprite = FindSprite(symbol, color);
+	if (m_sprites[sprite].pixels.size() == 0) {
+		return ;
+	}
+
+	Command &cmd = AddCommand(CMD_SPRITE);
+
+	cmd.first = m_points.size();
+	cmd.count = count;
+	cmd.sprite = sprite;
+	m_points.insert(m_points.end(), points, points + count);
+}
+
+size_t TiledRasterDrawSurface::FindSprite(Symbol *symbol, wxColour color)
+{
+	for (size_t n = 0; n < m_sprites.size(); n++) {
+		if (m_sprites[n].symbol == symbol && m_sprites[n].color == color) {
+			return n;
+		}
+	}
+
+	// sprite is converted here, because symbols can't be used
+	// from worker threads
+	m_sprites.push_back(Sprite());
+
+	Sprite &sprite = m_sprites.back();
+	sprite.symbol = symbol;
+	sprite.color = color;
+
+	const wxImage &image = symbol->GetSpriteImage(color, m_antialias, sprite.center);
+	sprite.width = image.GetWidth();
+	sprite.height = image.GetHeight();
+	if (sprite.width > 0 && sprite.height > 0) {
+		RasterDrawSurface::ImageToPixels(image, sprite.pixels);
+	}
+	return m_sprites.size() - 1;
+}
+
+void TiledRasterDrawSurface::RasterTile(size_t tile)
+{
+	RasterDrawSurface &surface = *m_tiles[tile];
+
+	const wxCoord tileTop = surface.GetRect().y;
+	const wxCoord tileBottom = tileTop + surface.GetRect().height;
+
+	// every tile starts with default pen and brush
+	surface.SetRasterPen(true, 0xFF000000, 1);
+	surface.SetRasterBrush(true, 0xFFFFFFFF);
+
+	for (size_t n = 0; n < m_commands.size(); n++) {
+		const Command &cmd = m_commands[n];
+
+		switch (cmd.type) {
+		case CMD_PEN:
+			surface.SetRasterPen(cmd.visible, cmd.color, cmd.width);
+			break;
+		case CMD_BRUSH:
+			surface.SetRasterBrush(cmd.visible, cmd.color);
+			break;
+		case CMD_LINE:
+			surface.DrawLine(cmd.x0, cmd.y0, cmd.x1, cmd.y1);
+			break;
+		case CMD_LINES:
+			surface.DrawLines(cmd.count, &m_points[cmd.first]);
+			break;
+		case CMD_RECTANGLE:
+			// skip rectangles, that are not in tile
+			if (wxMax(cmd.y0, cmd.y0 + cmd.y1) >= tileTop && wxMin(cmd.y0, cmd.y0 + cmd.y1) < tileBottom) {
+				surface.DrawRectangle(cmd.x0, cmd.y0, cmd.x1, cmd.y1);
+			}
+			break;
+		case CMD_SPRITE:
+			{
+				const Sprite &sprite = m_sprites[cmd.sprite];
+
+				surface.DrawSprite(&sprite.pixels[0], sprite.width, sprite.height, sprite.center,
+						&m_points[cmd.first], cmd.count);
+			}
+			break;
+		}
+	}
+}
@@ -9,6 +9,8 @@
 
 #include <wx/title.h>
 #include <wx/drawutils.h>
+#include <wx/textcache.h>
+#include <wx/drawsurface.h>
 #include <wx/tokenzr.h>
 #include <iostream>
 #include <wx/arrimpl.cpp>
@@ -19,7 +21,7 @@ WX_DEFINE_EXPORTED_OBJARRAY(Elements)
 TextElement::TextElement(const wxString& text, int hAlign, wxFont font)
 	: m_text(text)
 	, m_hAlign(hAlign)
-	, m_font(font)
+	, m_font(CopyFont(font))
 	, m_textColour(*wxBLACK)
 {
 }
@@ -53,7 +55,7 @@ void TextElement::Draw(wxDC& dc, wxRect rc)
 {
 	wxColour fgColour = dc.GetTextForeground();
 	dc.SetFont(m_font);
-	dc.SetBrush(*wxTRANSPARENT_BRUSH);
+	dc.SetBrush(wxBrush(*wxBLACK, wxBRUSHSTYLE_TRANSPARENT));
 	dc.SetTextForeground(m_textColour);
 	dc.DrawLabel(m_text, rc, m_hAlign);
 	dc.SetTextForeground(fgColour);
@@ -62,7 +64,7 @@ void TextElement::Draw(wxDC& dc, wxRect rc)
 wxSize TextElement::CalculateExtent(wxDC& dc)
 {
 	dc.SetFont(m_font);
-	return dc.GetMultiLineTextExtent(m_text);
+	return TextExtentCache::Get()->GetMultiLineTextExtent(dc, m_text);
 }
 
 
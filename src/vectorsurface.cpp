@@ -0,0 +1,225 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	vectorsurface.cpp
+// Purpose: vector output drawing surface implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/vectorsurface.h>
+#include <wx/symbol.h>
+
+#if wxUSE_SVG
+#include <wx/dcsvg.h>
+#endif /* wxUSE_SVG */
+
+#if wxUSE_PRINTING_ARCHITECTURE
+#include <wx/dcprint.h>
+#endif /* wxUSE_PRINTING_ARCHITECTURE */
+
+#include <utility>
+
+// maximal point count in polyline before simplification,
+// longer polylines are split
+const size_t maxPolylinePoints = 65536;
+
+/**
+ * Returns squared distance from point to segment.
+ */
+static double SegmentDistance2(const wxPoint &pt, const wxPoint &p0, const wxPoint &p1)
+{
+	double dx = p1.x - p0.x;
+	double dy = p1.y - p0.y;
+	double px = pt.x - p0.x;
+	double py = pt.y - p0.y;
+
+	double len2 = dx * dx + dy * dy;
+	if (len2 != 0) {
+		double t = (px * dx + py * dy) / len2;
+
+		if (t >= 1) {
+			px = pt.x - p1.x;
+			py = pt.y - p1.y;
+		}
+		else if (t > 0) {
+			px -= t * dx;
+			py -= t * dy;
+		}
+	}
+	return px * px + py * py;
+}
+
+VectorDrawSurface::VectorDrawSurface(wxDC &dc, double tolerance)
+: m_dc(dc)
+{
+	m_tolerance = tolerance;
+}
+
+VectorDrawSurface::~VectorDrawSurface()
+{
+	FlushPolyline();
+}
+
+wxDC &VectorDrawSurface::GetDC()
+{
+	return m_dc;
+}
+
+bool VectorDrawSurface::IsAntialiased()
+{
+	return IsAntialiasedDC(m_dc);
+}
+
+void VectorDrawSurface::Flush()
+{
+	FlushPolyline();
+}
+
+void VectorDrawSurface::SetPen(const wxPen &pen)
+{
+	FlushPolyline();
+	m_dc.SetPen(pen);
+}
+
+void VectorDrawSurface::SetBrush(const wxBrush &brush)
+{
+	m_dc.SetBrush(brush);
+}
+
+void VectorDrawSurface::DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1)
+{
+	// continue polyline, if line starts where it ends
+	if (m_polyline.size() == 0 || m_polyline.back() != wxPoint(x0, y0)) {
+		FlushPolyline();
+		m_polyline.push_back(wxPoint(x0, y0));
+	}
+	m_polyline.push_back(wxPoint(x1, y1));
+
+	if (m_polyline.size() >= maxPolylinePoints) {
+		// write part of polyline, and continue from its last point
+		wxPoint last = m_polyline.back();
+
+		FlushPolyline();
+		m_polyline.push_back(last);
+	}
+}
+
+void VectorDrawSurface::DrawLines(size_t count, const wxPoint *points)
+{
+	FlushPolyline();
+	DrawPolyline(points, count);
+}
+
+void VectorDrawSurface::DrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height)
+{
+	FlushPolyline();
+	m_dc.DrawRectangle(x, y, width, height);
+}
+
+void VectorDrawSurface::DrawSymbols(Symbol *symbol, const wxPoint *points, size_t count, wxColour color)
+{
+	FlushPolyline();
+
+	// draw symbols as vector shapes, not as bitmap sprites
+	for (size_t n = 0; n < count; n++) {
+		symbol->Draw(m_dc, points[n].x, points[n].y, color);
+	}
+}
+
+void VectorDrawSurface::DrawPolyline(const wxPoint *points, size_t count)
+{
+	Simplify(points, count, m_tolerance, m_simplified);
+
+	if (m_simplified.size() >= 2) {
+		m_dc.DrawLines(m_simplified.size(), &m_simplified[0]);
+	}
+}
+
+void VectorDrawSurface::FlushPolyline()
+{
+	if (m_polyline.size() != 0) {
+		DrawPolyline(&m_polyline[0], m_polyline.size());
+		m_polyline.clear();
+	}
+}
+
+bool VectorDrawSurface::IsVectorDC(wxDC &dc)
+{
+#if wxUSE_SVG
+	if (wxDynamicCast(&dc, wxSVGFileDC) != NULL) {
+		return true;
+	}
+#endif
+#if wxUSE_PRINTING_ARCHITECTURE
+	if (wxDynamicCast(&dc, wxPrinterDC) != NULL) {
+		return true;
+	}
+#endif
+	wxUnusedVar(dc);
+	return false;
+}
+
+void VectorDrawSurface::Simplify(const wxPoint *points, size_t count, double tolerance, std::vector<wxPoint> &result)
+{
+	result.clear();
+
+	// drop repeated points, dense data has many of them
+	for (size_t n = 0; n < count; n++) {
+		if (result.size() == 0 || result.back() != points[n]) {
+			result.push_back(points[n]);
+		}
+	}
+
+	const size_t size = result.size();
+	if (size < 3) {
+		return ;
+	}
+
+	const double tolerance2 = tolerance * tolerance;
+
+	std::vector<bool> keep(size, false);
+	keep[0] = keep[size - 1] = true;
+
+	// split ranges at farthest point, while it's farther than tolerance
+	std::vector<std::pair<size_t, size_t> > ranges;
+	ranges.push_back(std::make_pair((size_t) 0, size - 1));
+
+	while (ranges.size() != 0) {
+		size_t first = ranges.back().first;
+		size_t last = ranges.back().second;
+		ranges.pop_back();
+
+		double maxDist2 = 0;
+		size_t farthest = first;
+
+		for (size_t n = first + 1; n < last; n++) {
+			double dist2 = SegmentDistance2(result[n], result[first], result[last]);
+
+			if (dist2 > maxDist2) {
+				maxDist2 = dist2;
+				farthest = n;
+			}
+		}
+
+		if (maxDist2 > tolerance2) {
+			keep[farthest] = true;
+
+			if (farthest - first > 1) {
+				ranges.push_back(std::make_pair(first, farthest));
+			}
+			if (last - farthest > 1) {
+				ranges.push_back(std::make_pair(farthest, last));
+			}
+		}
+	}
+
+	// compact kept points
+	size_t kept = 0;
+	for (size_t n = 0; n < size; n++) {
+		if (keep[n]) {
+			result[kept++] = result[n];
+		}
+	}
+	result.resize(kept);
+}
@@ -0,0 +1,332 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	functiondataset.cpp
+// Purpose: function dataset base class implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/xy/functions/functiondataset.h>
+
+#include <math.h>
+
+// distance between initial samples in pixels
+static const double initialSpacing = 4;
+
+// minimal distance between samples in pixels
+static const double minSpacing = 0.5;
+
+// batch size to calculate y bounds
+static const size_t boundsBatchSize = 256;
+
+IMPLEMENT_CLASS(FunctionDataset, XYDataset)
+
+FunctionDataset::FunctionDataset(double minX, double maxX, double step)
+{
+	m_minX = minX;
+	m_maxX = maxX;
+	m_step = step;
+
+	m_tolerance = 0.5;
+
+	m_yBoundsValid = false;
+	m_minY = 0;
+	m_maxY = 0;
+}
+
+FunctionDataset::~FunctionDataset()
+{
+}
+
+double FunctionDataset::GetX(size_t index, size_t WXUNUSED(serie))
+{
+	return m_minX + index * m_step;
+}
+
+double FunctionDataset::GetY(size_t index, size_t WXUNUSED(serie))
+{
+	return CalcY(m_minX + index * m_step);
+}
+
+size_t FunctionDataset::GetCount(size_t WXUNUSED(serie))
+{
+	if (m_step <= 0 || m_maxX < m_minX) {
+		return 0;
+	}
+	return RoundHigh((m_maxX - m_minX) / m_step) + 1;
+}
+
+size_t FunctionDataset::GetSerieCount()
+{
+	return 1;
+}
+
+double FunctionDataset::GetMinX()
+{
+	return m_minX;
+}
+
+double FunctionDataset::GetMaxX()
+{
+	return m_maxX;
+}
+
+double FunctionDataset::GetMinY()
+{
+	UpdateYBounds();
+	return m_minY;
+}
+
+double FunctionDataset::GetMaxY()
+{
+	UpdateYBounds();
+	return m_maxY;
+}
+
+void FunctionDataset::SetTolerance(double tolerance)
+{
+	if (m_tolerance != tolerance && tolerance > 0) {
+		m_tolerance = tolerance;
+		DatasetChanged();
+	}
+}
+
+void FunctionDataset::CalcYArray(const double *x, double *y, size_t count)
+{
+	for (size_t n = 0; n < count; n++) {
+		y[n] = CalcY(x[n]);
+	}
+}
+
+void FunctionDataset::InvalidateCaches()
+{
+	XYDataset::InvalidateCaches();
+
+	m_yBoundsValid = false;
+}
+
+void FunctionDataset::UpdateYBounds()
+{
+	if (m_yBoundsValid) {
+		return ;
+	}
+
+	m_minY = 0;
+	m_maxY = 0;
+
+	//
+	// Y bounds must not depend on visible range, so calculate them
+	// using fixed step sampling of whole x range.
+	//
+	size_t count = 0;
+	if (m_step > 0 && m_maxX >= m_minX) {
+		count = RoundHigh((m_maxX - m_minX) / m_step) + 1;
+	}
+
+	double xs[boundsBatchSize];
+	double ys[boundsBatchSize];
+
+	bool first = true;
+	for (size_t index = 0; index < count; index += boundsBatchSize) {
+		size_t batchCount = wxMin(boundsBatchSize, count - index);
+
+		for (size_t n = 0; n < batchCount; n++) {
+			xs[n] = m_minX + (index + n) * m_step;
+		}
+
+		CalcYArray(xs, ys, batchCount);
+
+		for (size_t n = 0; n < batchCount; n++) {
+			if (first) {
+				m_minY = m_maxY = ys[n];
+				first = false;
+			}
+			else {
+				m_minY = wxMin(m_minY, ys[n]);
+				m_maxY = wxMax(m_maxY, ys[n]);
+			}
+		}
+	}
+
+	m_yBoundsValid = true;
+}
+
+void FunctionDataset::Sample(double minX, double maxX, wxCoord width, double yPixelSize,
+		std::vector<double> &xs, std::vector<double> &ys)
+{
+	xs.clear();
+	ys.clear();
+
+	// sample only visible part of function x range
+	double x0 = wxMax(minX, m_minX);
+	double x1 = wxMin(maxX, m_maxX);
+
+	if (x0 > x1 || width <= 0 || maxX <= minX) {
+		return ;
+	}
+
+	const double xPixelSize = (maxX - minX) / width;
+
+	//
+	// Initial samples with fixed pixel distance.
+	//
+	size_t count = (size_t) ceil((x1 - x0) / (xPixelSize * initialSpacing)) + 1;
+	if (count < 2) {
+		count = 2;
+	}
+
+	xs.resize(count);
+	ys.resize(count);
+	for (size_t n = 0; n < count; n++) {
+		xs[n] = x0 + (x1 - x0) * n / (count - 1);
+	}
+	xs[count - 1] = x1;
+
+	CalcYArray(&xs[0], &ys[0], count);
+
+	if (yPixelSize <= 0) {
+		return ; // can't measure deviation
+	}
+
+	//
+	// Refinement passes: segment midpoints are evaluated in one batch,
+	// and added, where curve deviates from segment. Segments that was split
+	// are checked again in next pass, until minimal spacing is reached.
+	//
+	std::vector<unsigned char> active(count - 1, 1);
+	std::vector<double> midXs;
+	std::vector<double> midYs;
+	std::vector<double> newXs;
+	std::vector<double> newYs;
+	std::vector<unsigned char> newActive;
+
+	double spacing = initialSpacing;
+	while (spacing / 2 >= minSpacing) {
+		midXs.clear();
+		for (size_t n = 0; n < active.size(); n++) {
+			if (active[n]) {
+				midXs.push_back((xs[n] + xs[n + 1]) / 2);
+			}
+		}
+
+		if (midXs.size() == 0) {
+			break;
+		}
+
+		midYs.resize(midXs.size());
+		CalcYArray(&midXs[0], &midYs[0], midXs.size());
+
+		spacing /= 2;
+		bool splitMore = (spacing / 2 >= minSpacing);
+
+		newXs.clear();
+		newYs.clear();
+		newActive.clear();
+
+		size_t nMid = 0;
+		for (size_t n = 0; n < active.size(); n++) {
+			newXs.push_back(xs[n]);
+			newYs.push_back(ys[n]);
+
+			if (!active[n]) {
+				newActive.push_back(0);
+				continue;
+			}
+
+			double midY = midYs[nMid];
+			double midX = midXs[nMid];
+			nMid++;
+
+			double deviation = fabs(midY - (ys[n] + ys[n + 1]) / 2) / yPixelSize;
+			if (deviation > m_tolerance) {
+				newXs.push_back(midX);
+				newYs.push_back(midY);
+				newActive.push_back(splitMore);
+				newActive.push_back(splitMore);
+			}
+			else {
+				newActive.push_back(0);
+			}
+		}
+		newXs.push_back(xs[count - 1]);
+		newYs.push_back(ys[count - 1]);
+
+		xs.swap(newXs);
+		ys.swap(newYs);
+		active.swap(newActive);
+		count = xs.size();
+	}
+}
+
+//
+// FunctionSamples
+//
+
+IMPLEMENT_CLASS(FunctionSamples, XYDataset)
+
+FunctionSamples::FunctionSamples(FunctionDataset *function)
+{
+	m_function = function;
+	m_function->AddRef();
+
+	m_sampled = false;
+	m_modificationCount = 0;
+	m_minX = 0;
+	m_maxX = 0;
+	m_width = 0;
+	m_yPixelSize = 0;
+}
+
+FunctionSamples::~FunctionSamples()
+{
+	SAFE_UNREF(m_function);
+}
+
+void FunctionSamples::Update(double minX, double maxX, wxCoord width, double yPixelSize)
+{
+	if (m_sampled && m_modificationCount == m_function->GetModificationCount() &&
+			m_minX == minX && m_maxX == maxX &&
+			m_width == width && m_yPixelSize == yPixelSize) {
+		return ; // samples for this range are cached
+	}
+
+	m_sampled = true;
+	m_modificationCount = m_function->GetModificationCount();
+	m_minX = minX;
+	m_maxX = maxX;
+	m_width = width;
+	m_yPixelSize = yPixelSize;
+
+	m_function->Sample(minX, maxX, width, yPixelSize, m_xs, m_ys);
+
+	// drop renderer caches for old samples
+	DatasetChanged();
+}
+
+double FunctionSamples::GetX(size_t index, size_t WXUNUSED(serie))
+{
+	wxCHECK_MSG(index < m_xs.size(), 0, wxT("FunctionSamples::GetX: Index is out of range"));
+	return m_xs[index];
+}
+
+double FunctionSamples::GetY(size_t index, size_t WXUNUSED(serie))
+{
+	wxCHECK_MSG(index < m_ys.size(), 0, wxT("FunctionSamples::GetY: Index is out of range"));
+	return m_ys[index];
+}
+
+size_t FunctionSamples::GetCount(size_t WXUNUSED(serie))
+{
+	return m_xs.size();
+}
+
+size_t FunctionSamples::GetSerieCount()
+{
+	return 1;
+}
+
+wxString FunctionSamples::GetSerieName(size_t serie)
+{
+	return m_function->GetSerieName(serie);
+}
@@ -12,14 +12,12 @@
 static wxString polynomFunctionName(wxT("Polynom function"));
 
 Polynom::Polynom(double *coefs, size_t coefCount, double min, double max, double step)
+: FunctionDataset(min, max, step)
 {
 	m_coefs = new double[coefCount];
 	for (size_t n = 0; n < coefCount; n++)
 		m_coefs[n] = coefs[n];
 	m_coefCount = coefCount;
-	m_min = min;
-	m_max = max;
-	m_step = step;
 }
 
 Polynom::~Polynom()
@@ -27,36 +25,31 @@ Polynom::~Polynom()
 	wxDELETEA(m_coefs);
 }
 
-double Polynom::GetX(size_t index, size_t WXUNUSED(serie))
-{
-	return m_min + index * m_step;
-}
-
-double Polynom::GetY(size_t index, size_t WXUNUSED(serie))
+double Polynom::CalcY(double x)
 {
-	return CalcY(GetX(index, 0));
-}
+	double y = 0;
 
-size_t Polynom::GetCount(size_t WXUNUSED(serie))
-{
-	return RoundHigh((m_max - m_min) / m_step);
+	// Horner's scheme
+	for (size_t n = 0; n < m_coefCount; n++) {
+		y = y * x + m_coefs[n];
+	}
+	return y;
 }
 
-size_t Polynom::GetSerieCount()
+void Polynom::CalcYArray(const double *x, double *y, size_t count)
 {
-	return 1;
-}
+	for (size_t i = 0; i < count; i++) {
+		y[i] = 0;
+	}
 
-double Polynom::CalcY(double x)
-{
-	double xn = 1;
-	double y = 0;
+	// Horner's scheme, one coefficient for whole batch per step
+	for (size_t n = 0; n < m_coefCount; n++) {
+		const double coef = m_coefs[n];
 
-	for (size_t n = m_coefCount - 1; n >= 0; n--) {
-		y += xn * m_coefs[n];
-		xn *= x;
+		for (size_t i = 0; i < count; i++) {
+			y[i] = y[i] * x[i] + coef;
+		}
 	}
-	return y;
 }
 
 wxString Polynom::GetSerieName(size_t WXUNUSED(serie))
@@ -14,36 +14,25 @@
 static wxString sineFunctionName(wxT("Sine function"));
 
 SineFunction::SineFunction(double a, double minX, double maxX, double step)
+: FunctionDataset(minX, maxX, step)
 {
 	m_a = a;
-	m_minX = minX;
-	m_maxX = maxX;
-	m_step = step;
 }
 
 SineFunction::~SineFunction()
 {
 }
 
-double SineFunction::GetX(size_t index, size_t WXUNUSED(serie))
+double SineFunction::CalcY(double x)
 {
-	return m_minX + index * m_step;
-}
-
-double SineFunction::GetY(size_t index, size_t WXUNUSED(serie))
-{
-	double x = m_minX + index * m_step;
 	return m_a * sin(x);
 }
 
-size_t SineFunction::GetCount(size_t WXUNUSED(serie))
-{
-	return RoundHigh((m_maxX - m_minX) / m_step) + 1;
-}
-
-size_t SineFunction::GetSerieCount()
+void SineFunction::CalcYArray(const double *x, double *y, size_t count)
 {
-	return 1;
+	for (size_t n = 0; n < count; n++) {
+		y[n] = m_a * sin(x[n]);
+	}
 }
 
 wxString SineFunction::GetSerieName(size_t WXUNUSED(serie))
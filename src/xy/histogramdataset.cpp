@@ -0,0 +1,435 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	histogramdataset.cpp
+// Purpose: histogram dataset implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/xy/histogramdataset.h>
+#include <wx/parallel.h>
+
+#include <math.h>
+#include <algorithm>
+
+/**
+ * Counts samples into base bins.
+ * Worker 0 counts samples directly to dataset base bins, other workers
+ * use own bins, that are merged later.
+ * Internal class, don't use from programs.
+ */
+class HistogramBinTask : public ParallelTask
+{
+public:
+	HistogramBinTask(const HistogramDataset *dataset, const double *values, double *baseCounts,
+			size_t baseBinCount, std::vector<std::vector<double> > &workerCounts,
+			std::vector<double> &underflowCounts, std::vector<double> &overflowCounts)
+	: m_workerCounts(workerCounts), m_underflowCounts(underflowCounts), m_overflowCounts(overflowCounts)
+	{
+		m_dataset = dataset;
+		m_values = values;
+		m_baseCounts = baseCounts;
+		m_baseBinCount = baseBinCount;
+	}
+
+	virtual ~HistogramBinTask()
+	{
+	}
+
+	virtual void Run(size_t first, size_t last, size_t worker)
+	{
+		double *counts = m_baseCounts;
+		if (worker != 0) {
+			m_workerCounts[worker].resize(m_baseBinCount, 0);
+			counts = &m_workerCounts[worker][0];
+		}
+
+		double underflow = 0;
+		double overflow = 0;
+		for (size_t n = first; n < last; n++) {
+			double value = m_values[n];
+			if (value != value) {
+				continue; // skip NaN
+			}
+
+			long bin = m_dataset->FindBaseBin(value);
+			if (bin < 0) {
+				underflow++;
+			}
+			else if ((size_t) bin >= m_baseBinCount) {
+				overflow++;
+			}
+			else {
+				counts[bin]++;
+			}
+		}
+
+		m_underflowCounts[worker] += underflow;
+		m_overflowCounts[worker] += overflow;
+	}
+
+private:
+	const HistogramDataset *m_dataset;
+	const double *m_values;
+	double *m_baseCounts;
+	size_t m_baseBinCount;
+	std::vector<std::vector<double> > &m_workerCounts;
+	std::vector<double> &m_underflowCounts;
+	std::vector<double> &m_overflowCounts;
+};
+
+IMPLEMENT_CLASS(HistogramDataset, XYDataset)
+
+HistogramDataset::HistogramDataset(double minValue, double maxValue, size_t binCount, size_t baseBinCount, bool logBins)
+{
+	m_logBins = logBins;
+	m_explicitEdges = false;
+	m_minValue = minValue;
+	m_maxValue = maxValue;
+	m_offset = 0;
+	m_scale = 0;
+
+	m_sampleCount = 0;
+	m_underflowCount = 0;
+	m_overflowCount = 0;
+
+	m_firstBase = 0;
+	m_lastBase = 0;
+	m_binCount = 0;
+
+	m_binsValid = false;
+	m_maxCount = 0;
+
+	wxCHECK_RET(maxValue > minValue && binCount != 0, wxT("HistogramDataset: Invalid bins range"));
+	wxCHECK_RET(!logBins || minValue > 0, wxT("HistogramDataset: Logarithmic bins range must be positive"));
+
+	// make base bin count multiple of displayed bin count
+	baseBinCount = wxMax(baseBinCount, binCount);
+	baseBinCount = (baseBinCount + binCount - 1) / binCount * binCount;
+
+	if (m_logBins) {
+		m_offset = log(minValue);
+		m_scale = baseBinCount / (log(maxValue) - m_offset);
+	}
+	else {
+		m_offset = minValue;
+		m_scale = baseBinCount / (maxValue - minValue);
+	}
+
+	m_baseCounts.resize(baseBinCount, 0);
+
+	m_lastBase = baseBinCount;
+	m_binCount = binCount;
+}
+
+HistogramDataset::HistogramDataset(const double *edges, size_t edgeCount)
+{
+	m_logBins = false;
+	m_explicitEdges = true;
+	m_minValue = 0;
+	m_maxValue = 0;
+	m_offset = 0;
+	m_scale = 0;
+
+	m_sampleCount = 0;
+	m_underflowCount = 0;
+	m_overflowCount = 0;
+
+	m_firstBase = 0;
+	m_lastBase = 0;
+	m_binCount = 0;
+
+	m_binsValid = false;
+	m_maxCount = 0;
+
+	wxCHECK_RET(edgeCount >= 2, wxT("HistogramDataset: At least two bin edges required"));
+
+	m_edges.assign(edges, edges + edgeCount);
+	std::sort(m_edges.begin(), m_edges.end());
+
+	m_minValue = m_edges[0];
+	m_maxValue = m_edges[edgeCount - 1];
+
+	m_baseCounts.resize(edgeCount - 1, 0);
+
+	m_lastBase = edgeCount - 1;
+	m_binCount = edgeCount - 1;
+}
+
+HistogramDataset::~HistogramDataset()
+{
+}
+
+double HistogramDataset::GetX(size_t index, size_t WXUNUSED(serie))
+{
+	double start = GetBinStart(index);
+	double end = GetBinEnd(index);
+
+	if (m_logBins) {
+		// center in logarithmic scale
+		return sqrt(start * end);
+	}
+	return (start + end) / 2;
+}
+
+double HistogramDataset::GetY(size_t index, size_t WXUNUSED(serie))
+{
+	UpdateBins();
+
+	wxCHECK_MSG(index < m_binCounts.size(), 0, wxT("HistogramDataset::GetY: Index is out of range"));
+	return m_binCounts[index];
+}
+
+size_t HistogramDataset::GetCount(size_t WXUNUSED(serie))
+{
+	return m_binCount;
+}
+
+size_t HistogramDataset::GetSerieCount()
+{
+	return 1;
+}
+
+wxString HistogramDataset::GetSerieName(size_t WXUNUSED(serie))
+{
+	return m_serieName;
+}
+
+void HistogramDataset::SetSerieName(const wxString &name)
+{
+	m_serieName = name;
+	DatasetChanged();
+}
+
+double HistogramDataset::GetMinX()
+{
+	if (m_binCount == 0) {
+		return 0;
+	}
+	return GetBinStart(0);
+}
+
+double HistogramDataset::GetMaxX()
+{
+	if (m_binCount == 0) {
+		return 0;
+	}
+	return GetBinEnd(m_binCount - 1);
+}
+
+double HistogramDataset::GetMinY()
+{
+	return 0;
+}
+
+double HistogramDataset::GetMaxY()
+{
+	UpdateBins();
+	return m_maxCount;
+}
+
+long HistogramDataset::FindBaseBin(double value) const
+{
+	const long baseBinCount = (long) m_baseCounts.size();
+
+	if (!(value >= m_minValue)) {
+		return -1;
+	}
+	if (value >= m_maxValue) {
+		return baseBinCount;
+	}
+
+	if (m_explicitEdges) {
+		return (long) (std::upper_bound(m_edges.begin(), m_edges.end(), value) - m_edges.begin()) - 1;
+	}
+
+	double pos;
+	if (m_logBins) {
+		pos = (log(value) - m_offset) * m_scale;
+	}
+	else {
+		pos = (value - m_offset) * m_scale;
+	}
+
+	// value is in range, so don't let rounding errors move it out
+	long bin = (long) pos;
+	return wxMax(0L, wxMin(bin, baseBinCount - 1));
+}
+
+void HistogramDataset::AddSample(double value)
+{
+	if (value != value) {
+		return ; // skip NaN
+	}
+
+	long bin = FindBaseBin(value);
+	if (bin < 0) {
+		m_underflowCount++;
+	}
+	else if ((size_t) bin >= m_baseCounts.size()) {
+		m_overflowCount++;
+	}
+	else {
+		m_baseCounts[bin]++;
+	}
+	m_sampleCount++;
+
+	DatasetChanged();
+}
+
+void HistogramDataset::AddSamples(const double *values, size_t count)
+{
+	if (count == 0 || m_baseCounts.size() == 0) {
+		return ;
+	}
+
+	const size_t workerCount = GetParallelWorkerCount();
+	const size_t baseBinCount = m_baseCounts.size();
+
+	std::vector<std::vector<double> > workerCounts(workerCount);
+	std::vector<double> underflowCounts(workerCount, 0);
+	std::vector<double> overflowCounts(workerCount, 0);
+
+	// worker bins are merged serially, so each worker must count
+	// much more samples than there are bins
+	size_t minItemsPerWorker = wxMax((size_t) 65536, baseBinCount * 16);
+
+	HistogramBinTask binTask(this, values, &m_baseCounts[0], baseBinCount,
+			workerCounts, underflowCounts, overflowCounts);
+	ParallelFor(binTask, count, minItemsPerWorker);
+
+	for (size_t worker = 0; worker < workerCount; worker++) {
+		m_underflowCount += underflowCounts[worker];
+		m_overflowCount += overflowCounts[worker];
+
+		if (worker == 0 || workerCounts[worker].size() == 0) {
+			continue;
+		}
+
+		const double *counts = &workerCounts[worker][0];
+		for (size_t n = 0; n < baseBinCount; n++) {
+			m_baseCounts[n] += counts[n];
+		}
+	}
+
+	for (size_t n = 0; n < count; n++) {
+		if (values[n] == values[n]) {
+			m_sampleCount++;
+		}
+	}
+
+	DatasetChanged();
+}
+
+void HistogramDataset::Clear()
+{
+	m_baseCounts.assign(m_baseCounts.size(), 0);
+
+	m_sampleCount = 0;
+	m_underflowCount = 0;
+	m_overflowCount = 0;
+
+	DatasetChanged();
+}
+
+void HistogramDataset::Rebin(size_t binCount)
+{
+	wxCHECK_RET(binCount != 0, wxT("HistogramDataset::Rebin: Invalid bin count"));
+
+	m_firstBase = 0;
+	m_lastBase = m_baseCounts.size();
+	m_binCount = wxMin(binCount, m_lastBase);
+
+	DatasetChanged();
+}
+
+void HistogramDataset::Rebin(double minValue, double maxValue, size_t binCount)
+{
+	wxCHECK_RET(binCount != 0 && maxValue > minValue, wxT("HistogramDataset::Rebin: Invalid bins"));
+
+	const long baseBinCount = (long) m_baseCounts.size();
+
+	long firstBase = FindBaseBin(minValue);
+	long lastBase = FindBaseBin(maxValue);
+
+	firstBase = wxMax(0L, wxMin(firstBase, baseBinCount - 1));
+	if (lastBase < baseBinCount && GetBaseEdge(wxMax(lastBase, 0L)) != maxValue) {
+		// bin, containing maxValue is displayed too
+		lastBase++;
+	}
+	lastBase = wxMax(firstBase + 1, wxMin(lastBase, baseBinCount));
+
+	m_firstBase = (size_t) firstBase;
+	m_lastBase = (size_t) lastBase;
+	m_binCount = wxMin(binCount, m_lastBase - m_firstBase);
+
+	DatasetChanged();
+}
+
+double HistogramDataset::GetBinStart(size_t index)
+{
+	wxCHECK_MSG(index < m_binCount, 0, wxT("HistogramDataset::GetBinStart: Index is out of range"));
+
+	size_t span = m_lastBase - m_firstBase;
+	return GetBaseEdge(m_firstBase + index * span / m_binCount);
+}
+
+double HistogramDataset::GetBinEnd(size_t index)
+{
+	wxCHECK_MSG(index < m_binCount, 0, wxT("HistogramDataset::GetBinEnd: Index is out of range"));
+
+	size_t span = m_lastBase - m_firstBase;
+	return GetBaseEdge(m_firstBase + (index + 1) * span / m_binCount);
+}
+
+double HistogramDataset::GetBaseEdge(size_t index)
+{
+	if (m_explicitEdges) {
+		return m_edges[index];
+	}
+	if (index >= m_baseCounts.size()) {
+		return m_maxValue;
+	}
+
+	if (m_logBins) {
+		return exp(m_offset + index / m_scale);
+	}
+	return m_offset + index / m_scale;
+}
+
+void HistogramDataset::InvalidateCaches()
+{
+	XYDataset::InvalidateCaches();
+
+	m_binsValid = false;
+}
+
+void HistogramDataset::UpdateBins()
+{
+	if (m_binsValid) {
+		return ;
+	}
+
+	m_binCounts.assign(m_binCount, 0);
+	m_maxCount = 0;
+
+	if (m_binCount != 0) {
+		//
+		// Displayed bin n consists of base bins [first + n * span / binCount,
+		// first + (n + 1) * span / binCount), so base bin b belongs to
+		// displayed bin ((b - first + 1) * binCount - 1) / span.
+		//
+		size_t span = m_lastBase - m_firstBase;
+		for (size_t base = m_firstBase; base < m_lastBase; base++) {
+			size_t bin = ((base - m_firstBase + 1) * m_binCount - 1) / span;
+			m_binCounts[bin] += m_baseCounts[base];
+		}
+
+		for (size_t n = 0; n < m_binCount; n++) {
+			m_maxCount = wxMax(m_maxCount, m_binCounts[n]);
+		}
+	}
+
+	m_binsValid = true;
+}
@@ -25,7 +25,7 @@ VectorDataset::~VectorDataset()
 void VectorDataset::Add(double y)
 {
 	m_values.Add(y);
-	DatasetChanged();
+	DatasetAppended();
 }
 
 void VectorDataset::Replace(size_t index, double y)
@@ -8,6 +8,11 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include <wx/xy/xyarearenderer.h>
+#include <wx/segmentclipper.h>
+
+#if wxUSE_GRAPHICS_CONTEXT
+#include <wx/dcgraph.h>
+#endif /* wxUSE_GRAPHICS_CONTEXT */
 
 //
 // TODO: need cleanup!
@@ -15,10 +20,16 @@
 
 IMPLEMENT_CLASS(XYAreaRenderer, XYRenderer)
 
+// count of segments, clipped at once
+const size_t clipChunkSize = 4096;
+
+// maximal segment count in graphics path, longer areas are drawn by parts
+const size_t maxPathSegments = 16384;
+
 XYAreaRenderer::XYAreaRenderer()
 {
-	m_outlinePen = *wxBLACK_PEN;
-	m_areaBrush = *wxGREY_BRUSH;
+	m_outlinePen = wxPen(*wxBLACK, 1, wxPENSTYLE_SOLID);
+	m_areaBrush = wxBrush(wxColour(128, 128, 128));
 }
 
 XYAreaRenderer::~XYAreaRenderer()
@@ -53,36 +64,132 @@ void XYAreaRenderer::Draw(wxDC &dc, wxRect rcData, wxCoord x0, wxCoord y0, wxCoo
 
 void XYAreaRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
+	DCDrawSurface surface(dc);
+	Draw(surface, rc, horizAxis, vertAxis, dataset);
+}
+
+void XYAreaRenderer::Draw(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+{
+	// areas are drawn to device context, in order with other drawings
+	surface.Flush();
+	wxDC &dc = surface.GetDC();
+
+#if wxUSE_GRAPHICS_CONTEXT
+	// filling and stroking each segment in graphics context is very slow,
+	// so segments are collected and drawn at once
+	wxGCDC *gcdc = wxDynamicCast(&dc, wxGCDC);
+	wxGraphicsContext *gc = (gcdc != NULL) ? gcdc->GetGraphicsContext() : NULL;
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+	SegmentClipper clipper(horizAxis->GetTransform(dc, rc.x, rc.width),
+			vertAxis->GetTransform(dc, rc.y, rc.height));
+
+	std::vector<double> xValues, yValues;
+	std::vector<wxPoint> segments;
+
 	FOREACH_SERIE(serie, dataset) {
-		dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(GetSerieColour(serie)));
+		const size_t count = dataset->GetCount(serie);
+		if (count < 2) {
+			continue;
+		}
+
+		dc.SetBrush(GetSerieStyle(serie).brush);
+
+		segments.clear();
+
+		// points are clipped by chunks, last point of chunk begins next one
+		for (size_t first = 0; first < count - 1; first += clipChunkSize) {
+			if (surface.IsCancelled()) {
+				return ;
+			}
 
-		for (size_t n = 0; n < dataset->GetCount(serie) - 1; n++) {
-			double x0 = dataset->GetX(n, serie);
-			double y0 = dataset->GetY(n, serie);
-			double x1 = dataset->GetX(n + 1, serie);
-			double y1 = dataset->GetY(n + 1, serie);
+			size_t last = wxMin(first + clipChunkSize, count - 1);
 
-			// check whether segment is visible
-			if (!horizAxis->IntersectsWindow(x0, x1) &&
-					!vertAxis->IntersectsWindow(y0, y1)) {
+			xValues.clear();
+			yValues.clear();
+			for (size_t n = first; n <= last; n++) {
+				xValues.push_back(dataset->GetX(n, serie));
+				yValues.push_back(dataset->GetY(n, serie));
+			}
+
+#if wxUSE_GRAPHICS_CONTEXT
+			if (gc != NULL) {
+				clipper.ClipArea(&xValues[0], &yValues[0], xValues.size(), segments);
+
+				if (segments.size() >= 2 * maxPathSegments) {
+					DrawPath(dc, gc, rc, segments);
+					segments.clear();
+				}
 				continue;
 			}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
 
-			ClipHoriz(horizAxis, x0, y0, x1, y1);
-			ClipHoriz(horizAxis, x1, y1, x0, y0);
-			ClipVert(vertAxis, x0, y0, x1, y1);
-			ClipVert(vertAxis, x1, y1, x0, y0);
+			segments.clear();
+			clipper.ClipArea(&xValues[0], &yValues[0], xValues.size(), segments);
 
-			// translate to graphics coordinates.
-			wxCoord xg0, yg0;
-			wxCoord xg1, yg1;
+			for (size_t n = 0; n < segments.size(); n += 2) {
+				Draw(dc, rc, segments[n].x, segments[n].y, segments[n + 1].x, segments[n + 1].y);
+			}
+		}
 
-			xg0 = horizAxis->ToGraphics(dc, rc.x, rc.width, x0);
-			yg0 = vertAxis->ToGraphics(dc, rc.y, rc.height, y0);
-			xg1 = horizAxis->ToGraphics(dc, rc.x, rc.width, x1);
-			yg1 = vertAxis->ToGraphics(dc, rc.y, rc.height, y1);
+#if wxUSE_GRAPHICS_CONTEXT
+		if (gc != NULL && segments.size() != 0) {
+			DrawPath(dc, gc, rc, segments);
+		}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+	}
+}
+
+#if wxUSE_GRAPHICS_CONTEXT
+void XYAreaRenderer::DrawPath(wxDC &dc, wxGraphicsContext *gc, wxRect rcData, const std::vector<wxPoint> &segments)
+{
+	const wxCoord bottom = rcData.y + rcData.height;
 
-			Draw(dc, rc, xg0, yg0, xg1, yg1);
+	wxGraphicsPath area = gc->CreatePath();
+	wxGraphicsPath outline = gc->CreatePath();
+
+	int direction = 0; // x direction of current polygon
+	for (size_t n = 0; n < segments.size(); n += 2) {
+		const wxPoint &pt0 = segments[n];
+		const wxPoint &pt1 = segments[n + 1];
+
+		int segmentDirection = (pt1.x > pt0.x) ? 1 : ((pt1.x < pt0.x) ? -1 : 0);
+
+		bool connected = (n != 0 && segments[n - 1] == pt0);
+		// polygon, that turns back over itself, would have holes
+		// with winding rule, so it's closed at turn
+		bool reversed = (direction != 0 && segmentDirection == -direction);
+
+		if (!connected || reversed) {
+			if (n != 0) {
+				// close polygon of previous connected segments
+				area.AddLineToPoint(segments[n - 1].x, bottom);
+				area.CloseSubpath();
+			}
+
+			area.MoveToPoint(pt0.x, bottom);
+			area.AddLineToPoint(pt0.x, pt0.y);
+			if (!connected) {
+				outline.MoveToPoint(pt0.x, pt0.y);
+			}
+			direction = 0;
 		}
+
+		if (segmentDirection != 0) {
+			direction = segmentDirection;
+		}
+
+		area.AddLineToPoint(pt1.x, pt1.y);
+		outline.AddLineToPoint(pt1.x, pt1.y);
 	}
+
+	area.AddLineToPoint(segments.back().x, bottom);
+	area.CloseSubpath();
+
+	// area brush is set by caller
+	gc->FillPath(area, wxWINDING_RULE);
+
+	dc.SetPen(m_outlinePen);
+	gc->StrokePath(outline);
 }
+#endif /* wxUSE_GRAPHICS_CONTEXT */
@@ -0,0 +1,464 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:	xydensityrenderer.cpp
+// Purpose: xy density (binned heatmap) renderer implementation
+// Author:	agent
+// Created:	2026/10/18
+// Copyright:	(c) 2026 agent
+// Licence:	wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/xy/xydensityrenderer.h>
+#include <wx/parallel.h>
+
+#if wxUSE_GRAPHICS_CONTEXT
+#include <wx/dcgraph.h>
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+#include <math.h>
+
+// colour lookup table size
+static const size_t colourTableSize = 256;
+
+// minimal cells count to merge by one worker
+static const size_t minMergeCells = 65536;
+
+// count of points, transformed by one batch
+static const size_t binChunkSize = 256;
+
+// count of points, counted between drawing cancellation checks
+static const size_t binBlockSize = 1 << 20;
+
+/**
+ * Counts points of serie in grid.
+ * Worker 0 counts points directly in target grid, other workers
+ * use own grids, that are merged into target grid later.
+ * Workers use only precomputed axis transforms, visibility is checked
+ * in graphics space, so axes aren't called from worker threads.
+ * Internal class, don't use from programs.
+ */
+class DensityBinTask : public ParallelTask
+{
+public:
+	DensityBinTask(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset,
+			size_t serie, size_t firstIndex, unsigned int *grid,
+			std::vector<std::vector<unsigned int> > &workerGrids)
+	: m_workerGrids(workerGrids)
+	{
+		m_rc = rc;
+		m_horizTransform = horizAxis->GetTransform(dc, rc.x, rc.width);
+		m_vertTransform = vertAxis->GetTransform(dc, rc.y, rc.height);
+		m_dataset = dataset;
+		m_serie = serie;
+		m_firstIndex = firstIndex;
+		m_grid = grid;
+	}
+
+	virtual ~DensityBinTask()
+	{
+	}
+
+	/**
+	 * Checks whether task can be run from worker threads.
+	 * Transforms of nonlinear axes call axis for each value, so they
+	 * must be used only from calling thread.
+	 * @return true if task can be run in parallel
+	 */
+	bool IsParallel() const
+	{
+		return m_horizTransform.IsPrecomputed() && m_vertTransform.IsPrecomputed();
+	}
+
+	virtual void Run(size_t first, size_t last, size_t worker)
+	{
+		unsigned int *grid = m_grid;
+		if (worker != 0) {
+			std::vector<unsigned int> &workerGrid = m_workerGrids[worker];
+			if (workerGrid.size() == 0) {
+				workerGrid.resize(m_rc.width * m_rc.height, 0);
+			}
+			grid = &workerGrid[0];
+		}
+
+		//
+		// Visible values are mapped into transform coordinate range, and
+		// values out of axis bounds (or not positive for logarithmic
+		// axes, that give NaN or infinity) are mapped out of it. Small
+		// tolerance keeps points on axis bounds, lost by rounding.
+		//
+		wxCoord minX, maxX, minY, maxY;
+		m_horizTransform.GetCoordRange(minX, maxX);
+		m_vertTransform.GetCoordRange(minY, maxY);
+
+		const double tolerance = 1e-6;
+		const double xLow = minX - tolerance;
+		const double xHigh = maxX + tolerance;
+		const double yLow = minY - tolerance;
+		const double yHigh = maxY + tolerance;
+
+		double xs[binChunkSize];
+		double ys[binChunkSize];
+
+		for (size_t chunkFirst = m_firstIndex + first; chunkFirst < m_firstIndex + last; chunkFirst += binChunkSize) {
+			size_t chunkCount = wxMin(binChunkSize, m_firstIndex + last - chunkFirst);
+
+			for (size_t n = 0; n < chunkCount; n++) {
+				xs[n] = m_dataset->GetX(chunkFirst + n, m_serie);
+				ys[n] = m_dataset->GetY(chunkFirst + n, m_serie);
+			}
+
+			m_horizTransform.ToGraphics(xs, xs, chunkCount);
+			m_vertTransform.ToGraphics(ys, ys, chunkCount);
+
+			for (size_t n = 0; n < chunkCount; n++) {
+				if (!(xs[n] >= xLow && xs[n] <= xHigh && ys[n] >= yLow && ys[n] <= yHigh)) {
+					continue;
+				}
+
+				wxCoord x = (wxCoord) xs[n] - m_rc.x;
+				wxCoord y = (wxCoord) ys[n] - m_rc.y;
+
+				x = wxMax(0, wxMin(x, m_rc.width - 1));
+				y = wxMax(0, wxMin(y, m_rc.height - 1));
+
+				grid[y * m_rc.width + x]++;
+			}
+		}
+	}
+
+private:
+	wxRect m_rc;
+	AxisTransform m_horizTransform;
+	AxisTransform m_vertTransform;
+	XYDataset *m_dataset;
+	size_t m_serie;
+	size_t m_firstIndex;
+	unsigned int *m_grid;
+	std::vector<std::vector<unsigned int> > &m_workerGrids;
+};
+
+/**
+ * Adds worker grids to target grid.
+ * Internal class, don't use from programs.
+ */
+class DensityMergeTask : public ParallelTask
+{
+public:
+	DensityMergeTask(unsigned int *grid, std::vector<std::vector<unsigned int> > &workerGrids)
+	: m_workerGrids(workerGrids)
+	{
+		m_grid = grid;
+	}
+
+	virtual ~DensityMergeTask()
+	{
+	}
+
+	virtual void Run(size_t first, size_t last, size_t WXUNUSED(worker))
+	{
+		for (size_t nGrid = 1; nGrid < m_workerGrids.size(); nGrid++) {
+			if (m_workerGrids[nGrid].size() == 0) {
+				continue;
+			}
+
+			const unsigned int *workerGrid = &m_workerGrids[nGrid][0];
+			for (size_t n = first; n < last; n++) {
+				m_grid[n] += workerGrid[n];
+			}
+		}
+	}
+
+private:
+	unsigned int *m_grid;
+	std::vector<std::vector<unsigned int> > &m_workerGrids;
+};
+
+IMPLEMENT_CLASS(XYDensityRenderer, XYRenderer)
+
+XYDensityRenderer::XYDensityRenderer(const wxColour &lowColour, const wxColour &highColour, bool logScale)
+{
+	m_lowColour = lowColour;
+	m_highColour = highColour;
+	m_logScale = logScale;
+
+	m_gridValid = false;
+	m_maxCount = 0;
+	m_dataset = NULL;
+	m_modificationCount = 0;
+	m_gridWidth = 0;
+	m_gridHeight = 0;
+	m_minX = 0;
+	m_maxX = 0;
+	m_minY = 0;
+	m_maxY = 0;
+
+	m_imageValid = false;
+
+	UpdateColourTable();
+}
+
+XYDensityRenderer::~XYDensityRenderer()
+{
+}
+
+void XYDensityRenderer::SetColours(const wxColour &lowColour, const wxColour &highColour)
+{
+	m_lowColour = lowColour;
+	m_highColour = highColour;
+	UpdateColourTable();
+
+	m_imageValid = false;
+	FireNeedRedraw();
+}
+
+void XYDensityRenderer::SetLogScale(bool logScale)
+{
+	if (m_logScale != logScale) {
+		m_logScale = logScale;
+
+		m_imageValid = false;
+		FireNeedRedraw();
+	}
+}
+
+void XYDensityRenderer::ResetGrid()
+{
+	m_gridValid = false;
+	m_imageValid = false;
+}
+
+void XYDensityRenderer::DrawLegendSymbol(wxDC &dc, wxRect rcSymbol, size_t WXUNUSED(serie))
+{
+	dc.SetBrush(wxBrush(m_highColour));
+	dc.SetPen(wxPen(m_highColour, 1, wxPENSTYLE_SOLID));
+
+	dc.DrawRectangle(rcSymbol);
+}
+
+void XYDensityRenderer::UpdateColourTable()
+{
+	m_colourTable.resize(colourTableSize * 3);
+
+	for (size_t n = 0; n < colourTableSize; n++) {
+		double k = (double) n / (colourTableSize - 1);
+
+		m_colourTable[n * 3 + 0] = (unsigned char) (m_lowColour.Red() + k * (m_highColour.Red() - m_lowColour.Red()));
+		m_colourTable[n * 3 + 1] = (unsigned char) (m_lowColour.Green() + k * (m_highColour.Green() - m_lowColour.Green()));
+		m_colourTable[n * 3 + 2] = (unsigned char) (m_lowColour.Blue() + k * (m_highColour.Blue() - m_lowColour.Blue()));
+	}
+}
+
+bool XYDensityRenderer::CanAppend(XYDataset *dataset)
+{
+	if (dataset->GetSerieCount() != m_serieStates.size()) {
+		return false;
+	}
+
+	for (size_t serie = 0; serie < m_serieStates.size(); serie++) {
+		const SerieState &state = m_serieStates[serie];
+
+		if (dataset->GetCount(serie) < state.count) {
+			return false;
+		}
+		if (state.count == 0) {
+			continue;
+		}
+
+		// points that are counted must stay unchanged
+		if (dataset->GetX(0, serie) != state.firstX ||
+				dataset->GetY(0, serie) != state.firstY ||
+				dataset->GetX(state.count - 1, serie) != state.lastX ||
+				dataset->GetY(state.count - 1, serie) != state.lastY) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void XYDensityRenderer::SaveSerieState(XYDataset *dataset)
+{
+	m_serieStates.resize(dataset->GetSerieCount());
+
+	FOREACH_SERIE(serie, dataset) {
+		SerieState &state = m_serieStates[serie];
+
+		state.count = dataset->GetCount(serie);
+		if (state.count != 0) {
+			state.firstX = dataset->GetX(0, serie);
+			state.firstY = dataset->GetY(0, serie);
+			state.lastX = dataset->GetX(state.count - 1, serie);
+			state.lastY = dataset->GetY(state.count - 1, serie);
+		}
+		else {
+			state.firstX = state.firstY = 0;
+			state.lastX = state.lastY = 0;
+		}
+	}
+}
+
+void XYDensityRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+{
+	DCDrawSurface surface(dc);
+	Draw(surface, rc, horizAxis, vertAxis, dataset);
+}
+
+void XYDensityRenderer::Draw(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+{
+	// grid bitmap is drawn to device context, in order with other drawings
+	surface.Flush();
+	wxDC &dc = surface.GetDC();
+
+	if (rc.width <= 0 || rc.height <= 0) {
+		return ;
+	}
+
+	// axes window, that grid is counted for
+	double minX = horizAxis->ToData(dc, rc.x, rc.width, rc.x);
+	double maxX = horizAxis->ToData(dc, rc.x, rc.width, rc.x + rc.width);
+	double minY = vertAxis->ToData(dc, rc.y, rc.height, rc.y + rc.height);
+	double maxY = vertAxis->ToData(dc, rc.y, rc.height, rc.y);
+
+	const size_t cellCount = rc.width * rc.height;
+
+	if (!m_gridValid || m_dataset != dataset ||
+			m_modificationCount != dataset->GetModificationCount() ||
+			m_gridWidth != rc.width || m_gridHeight != rc.height ||
+			m_minX != minX || m_maxX != maxX || m_minY != minY || m_maxY != maxY ||
+			!CanAppend(dataset)) {
+		// count all points again
+		m_grid.assign(cellCount, 0);
+		m_serieStates.assign(dataset->GetSerieCount(), SerieState());
+
+		m_dataset = dataset;
+		m_modificationCount = dataset->GetModificationCount();
+		m_gridWidth = rc.width;
+		m_gridHeight = rc.height;
+		m_minX = minX;
+		m_maxX = maxX;
+		m_minY = minY;
+		m_maxY = maxY;
+		m_gridValid = true;
+		m_imageValid = false;
+	}
+
+	//
+	// Count new points. Worker grids are worth allocating
+	// only when each worker has many points to count.
+	//
+	std::vector<std::vector<unsigned int> > workerGrids(GetParallelWorkerCount());
+	size_t minItemsPerWorker = wxMax((size_t) 4096, cellCount / 2);
+
+	bool gridChanged = false;
+	FOREACH_SERIE(serie, dataset) {
+		size_t first = m_serieStates[serie].count;
+		size_t count = dataset->GetCount(serie);
+
+		for (size_t blockFirst = first; blockFirst < count; blockFirst += binBlockSize) {
+			if (surface.IsCancelled()) {
+				// grid is partially counted
+				ResetGrid();
+				return ;
+			}
+
+			size_t blockCount = wxMin(binBlockSize, count - blockFirst);
+
+			DensityBinTask binTask(dc, rc, horizAxis, vertAxis, dataset, serie, blockFirst, &m_grid[0], workerGrids);
+			if (binTask.IsParallel()) {
+				ParallelFor(binTask, blockCount, minItemsPerWorker);
+			}
+			else {
+				binTask.Run(0, blockCount, 0);
+			}
+			gridChanged = true;
+		}
+	}
+
+	for (size_t n = 1; n < workerGrids.size(); n++) {
+		if (workerGrids[n].size() != 0) {
+			DensityMergeTask mergeTask(&m_grid[0], workerGrids);
+			ParallelFor(mergeTask, cellCount, minMergeCells);
+			break;
+		}
+	}
+
+	if (gridChanged) {
+		SaveSerieState(dataset);
+		m_imageValid = false;
+	}
+
+	if (!m_imageValid) {
+		UpdateImage();
+	}
+
+#if wxUSE_GRAPHICS_CONTEXT
+	// graphics bitmap is created from image without wxBitmap,
+	// so it can be drawn from any thread
+	wxGCDC *gcdc = wxDynamicCast(&dc, wxGCDC);
+	if (gcdc != NULL && gcdc->GetGraphicsContext() != NULL) {
+		wxGraphicsContext *gc = gcdc->GetGraphicsContext();
+
+		wxGraphicsBitmap bitmap = gc->CreateBitmapFromImage(m_image);
+		gc->DrawBitmap(bitmap, rc.x, rc.y, m_gridWidth, m_gridHeight);
+		return ;
+	}
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+	wxCHECK_RET(IsMainThread(), wxT("XYDensityRenderer::Draw: only graphics context can be used from worker thread"));
+
+	dc.DrawBitmap(wxBitmap(m_image), rc.x, rc.y, true);
+}
+
+void XYDensityRenderer::UpdateImage()
+{
+	const size_t cellCount = m_grid.size();
+
+	m_maxCount = 0;
+	for (size_t n = 0; n < cellCount; n++) {
+		m_maxCount = wxMax(m_maxCount, m_grid[n]);
+	}
+
+	wxImage image(m_gridWidth, m_gridHeight, false);
+	image.InitAlpha();
+
+	unsigned char *data = image.GetData();
+	unsigned char *alpha = image.GetAlpha();
+
+	//
+	// Map counts to colour table indices. Counts are scaled from [1, maxCount]
+	// to [0, colourTableSize - 1], empty cells are transparent.
+	//
+	double scale = 0;
+	if (m_maxCount > 1) {
+		if (m_logScale) {
+			scale = (colourTableSize - 1) / log((double) m_maxCount);
+		}
+		else {
+			scale = (double) (colourTableSize - 1) / (m_maxCount - 1);
+		}
+	}
+
+	for (size_t n = 0; n < cellCount; n++) {
+		unsigned int count = m_grid[n];
+		if (count == 0) {
+			data[n * 3 + 0] = data[n * 3 + 1] = data[n * 3 + 2] = 0;
+			alpha[n] = 0;
+			continue;
+		}
+
+		size_t index;
+		if (m_logScale) {
+			index = (size_t) (log((double) count) * scale);
+		}
+		else {
+			index = (size_t) ((count - 1) * scale);
+		}
+		index = wxMin(index, colourTableSize - 1);
+
+		data[n * 3 + 0] = m_colourTable[index * 3 + 0];
+		data[n * 3 + 1] = m_colourTable[index * 3 + 1];
+		data[n * 3 + 2] = m_colourTable[index * 3 + 2];
+		alpha[n] = 255;
+	}
+
+	m_image = image;
+	m_imageValid = true;
+}
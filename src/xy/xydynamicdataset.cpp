@@ -90,7 +90,7 @@ void XYDynamicSerie::AddXY(const wxRealPoint& xy)
 	m_data.Add(xy);
 
 	if (m_dataset != NULL) {
-		m_dataset->DatasetChanged();
+		m_dataset->DatasetAppended();
 	}
 }
 
@@ -99,7 +99,7 @@ void XYDynamicSerie::AddXY(const wxRealPointArray& data)
 	WX_APPEND_ARRAY(m_data, data)
 
 	if (m_dataset != NULL) {
-		m_dataset->DatasetChanged();
+		m_dataset->DatasetAppended();
 	}
 }
 
@@ -12,6 +12,9 @@
 
 IMPLEMENT_CLASS(XYHistoRenderer, XYRenderer)
 
+// how often drawing cancellation is checked, in bars
+const size_t cancelCheckInterval = 4096;
+
 XYHistoRenderer::XYHistoRenderer(int barWidth, bool vertical)
 {
 	m_barWidth = barWidth;
@@ -47,8 +50,25 @@ void XYHistoRenderer::DrawBar(int serie, wxDC &dc, wxRect rcData, wxCoord x, wxC
 
 void XYHistoRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
+	DCDrawSurface surface(dc);
+	Draw(surface, rc, horizAxis, vertAxis, dataset);
+}
+
+void XYHistoRenderer::Draw(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+{
+	// bars are drawn to device context, in order with other drawings
+	surface.Flush();
+	wxDC &dc = surface.GetDC();
+
+	AxisTransform horizTransform = horizAxis->GetTransform(dc, rc.x, rc.width);
+	AxisTransform vertTransform = vertAxis->GetTransform(dc, rc.y, rc.height);
+
 	FOREACH_SERIE(serie, dataset) {
 		FOREACH_DATAITEM(n, serie, dataset) {
+			if ((n % cancelCheckInterval) == 0 && surface.IsCancelled()) {
+				return ;
+			}
+
 			double xVal;
 			double yVal;
 
@@ -66,8 +86,8 @@ void XYHistoRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis,
 				continue;
 			}
 
-			wxCoord x = horizAxis->ToGraphics(dc, rc.x, rc.width, xVal);
-			wxCoord y = vertAxis->ToGraphics(dc, rc.y, rc.height, yVal);
+			wxCoord x = horizTransform.ToGraphics(xVal);
+			wxCoord y = vertTransform.ToGraphics(yVal);
 
 			DrawBar(serie, dc, rc, x, y);
 		}
@@ -9,10 +9,15 @@
 
 #include <wx/xy/xylinerenderer.h>
 
+#include <vector>
+
 IMPLEMENT_CLASS(XYLineRendererBase, XYRenderer)
 IMPLEMENT_CLASS(XYLineRenderer, XYLineRendererBase)
 IMPLEMENT_CLASS(XYLineStepRenderer, XYLineRendererBase)
 
+// how often drawing cancellation is checked, in points
+const size_t cancelCheckInterval = 4096;
+
 //
 // XYLineRendererBase
 //
@@ -23,6 +28,7 @@ XYLineRendererBase::XYLineRendererBase(bool drawSymbols, bool drawLines, int def
 	m_defaultPenStyle = defaultPenStyle;
 	m_drawSymbols = drawSymbols;
 	m_drawLines = drawLines;
+	m_symbolCulling = true;
 }
 
 XYLineRendererBase::~XYLineRendererBase()
@@ -38,14 +44,25 @@ void XYLineRendererBase::SetSeriePen(size_t serie, wxPen *pen)
 wxPen *XYLineRendererBase::GetSeriePen(size_t serie)
 {
 	if (m_seriePens.find(serie) == m_seriePens.end()) {
-		return wxThePenList->FindOrCreatePen(GetDefaultColour(serie), m_defaultPenWidth, m_defaultPenStyle);
+		// default pen is kept by renderer, global pen list
+		// can't be used while drawing in worker thread
+		m_seriePens[serie] = wxPen(GetDefaultColour(serie), m_defaultPenWidth, m_defaultPenStyle);
 	}
 	return &m_seriePens[serie];
 }
 
+void XYLineRendererBase::SetSymbolCulling(bool symbolCulling)
+{
+	if (m_symbolCulling != symbolCulling) {
+		m_symbolCulling = symbolCulling;
+		FireNeedRedraw();
+	}
+}
+
 void XYLineRendererBase::SetSerieColour(size_t serie, wxColour *colour)
 {
-	SetSeriePen(serie, wxThePenList->FindOrCreatePen(*colour, m_defaultPenWidth, m_defaultPenStyle));
+	wxPen pen(*colour, m_defaultPenWidth, m_defaultPenStyle);
+	SetSeriePen(serie, &pen);
 }
 
 wxColour XYLineRendererBase::GetSerieColour(size_t serie)
@@ -56,14 +73,26 @@ wxColour XYLineRendererBase::GetSerieColour(size_t serie)
 	return m_seriePens[serie].GetColour();
 }
 
+void XYLineRendererBase::ResolveSerieStyle(size_t serie, SerieStyle &style)
+{
+	XYRenderer::ResolveSerieStyle(serie, style);
+	style.pen = *GetSeriePen(serie);
+}
+
 void XYLineRendererBase::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+{
+  DCDrawSurface surface(dc);
+  Draw(surface, rc, horizAxis, vertAxis, dataset);
+}
+
+void XYLineRendererBase::Draw(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
   if(m_drawLines) {
-    DrawLines(dc, rc, horizAxis, vertAxis, dataset);
+    DrawLines(surface, rc, horizAxis, vertAxis, dataset);
   }
 
   if(m_drawSymbols) {
-    DrawSymbols(dc, rc, horizAxis, vertAxis, dataset);
+    DrawSymbols(surface, rc, horizAxis, vertAxis, dataset);
   }
 }
 
@@ -83,26 +112,117 @@ void XYLineRendererBase::DrawLegendSymbol(wxDC &dc, wxRect rcSymbol, size_t seri
 	}
 }
 
-void XYLineRendererBase::DrawSymbols(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+void XYLineRendererBase::DrawSymbols(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
+  wxDC &dc = surface.GetDC();
+  std::vector<wxPoint> points;
+
+  // visible values, and their graphics coordinates
+  std::vector<double> xValues, yValues;
+  std::vector<wxCoord> xCoords, yCoords;
+
+  AxisTransform horizTransform = horizAxis->GetTransform(dc, rc.x, rc.width);
+  AxisTransform vertTransform = vertAxis->GetTransform(dc, rc.y, rc.height);
+
+  m_symbolOccupancy.ResetCulledCount();
+
+  // antialiased edges of overlapping symbols are blended, so culling
+  // would change output
+  const bool antialiased = surface.IsAntialiased();
+
   FOREACH_SERIE(serie, dataset) {
-    Symbol *symbol = GetSerieSymbol(serie);
-    wxColour color = GetSerieColour(serie);
+    const SerieStyle &style = GetSerieStyle(serie);
+
+    // the same for semi-transparent symbols
+    const bool cull = m_symbolCulling && !antialiased && style.colour.Alpha() == wxALPHA_OPAQUE;
+
+    // collect visible points, and draw symbols for them at once
+    points.clear();
+    xValues.clear();
+    yValues.clear();
+    m_symbolOccupancy.Reset(rc);
+
+    // coarse preview draws only part of points
+    const size_t count = dataset->GetCount(serie);
+    const size_t stride = surface.GetSampleStride(count);
+
+    for(size_t n = 0; n < count; n += stride) {
+      if ((n % (cancelCheckInterval * stride)) == 0 && surface.IsCancelled()) {
+        return ;
+      }
 
-    for(size_t n = 0; n < dataset->GetCount(serie); ++n) {
       double x = dataset->GetX(n, serie);
       double y = dataset->GetY(n, serie);
 
       if(horizAxis->IsVisible(x) && vertAxis->IsVisible(y)) {
-        int xg = horizAxis->ToGraphics(dc, rc.x, rc.width, x);
-        int yg = vertAxis->ToGraphics(dc, rc.y, rc.height, y);
+        xValues.push_back(x);
+        yValues.push_back(y);
+      }
+    }
+
+    if (xValues.size() == 0) {
+      continue;
+    }
+
+    // translate all visible points at once
+    xCoords.resize(xValues.size());
+    yCoords.resize(yValues.size());
+    horizTransform.ToGraphics(&xValues[0], &xCoords[0], xValues.size());
+    vertTransform.ToGraphics(&yValues[0], &yCoords[0], yValues.size());
 
-        symbol->Draw(dc, xg, yg, color);
+    for (size_t n = 0; n < xCoords.size(); n++) {
+      // the same symbol is already drawn here
+      if (cull && !m_symbolOccupancy.Occupy(xCoords[n], yCoords[n])) {
+        continue;
       }
+
+      points.push_back(wxPoint(xCoords[n], yCoords[n]));
+    }
+
+    if (points.size() != 0) {
+      surface.DrawSymbols(style.symbol, &points[0], points.size(), style.colour);
     }
   }
 }
 
+bool XYLineRendererBase::DrawSerieLines(DrawSurface &surface, SegmentClipper &clipper, XYDataset *dataset, size_t serie, size_t first)
+{
+  std::vector<double> xValues, yValues;
+  std::vector<wxPoint> segments;
+
+  // coarse preview connects every stride-th point
+  const size_t count = dataset->GetCount(serie);
+  const size_t stride = surface.GetSampleStride(count);
+
+  // points are clipped by chunks, last point of chunk begins next one
+  size_t n = first;
+  while (n < count - 1) {
+    if (surface.IsCancelled()) {
+      return false;
+    }
+
+    xValues.clear();
+    yValues.clear();
+    for (;;) {
+      xValues.push_back(dataset->GetX(n, serie));
+      yValues.push_back(dataset->GetY(n, serie));
+
+      if (n == count - 1 || xValues.size() > cancelCheckInterval) {
+        break;
+      }
+      n = wxMin(n + stride, count - 1);
+    }
+
+    segments.clear();
+    clipper.ClipPolyline(&xValues[0], &yValues[0], xValues.size(), segments);
+
+    for (size_t i = 0; i < segments.size(); i += 2) {
+      surface.DrawLine(segments[i].x, segments[i].y, segments[i + 1].x, segments[i + 1].y);
+    }
+  }
+  return true;
+}
+
 //
 // XYLineRenderer
 //
@@ -117,42 +237,22 @@ XYLineRenderer::~XYLineRenderer()
 }
 
 
-void XYLineRenderer::DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+void XYLineRenderer::DrawLines(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
+  wxDC &dc = surface.GetDC();
+
+  SegmentClipper clipper(horizAxis->GetTransform(dc, rc.x, rc.width),
+      vertAxis->GetTransform(dc, rc.y, rc.height));
+
   FOREACH_SERIE(serie, dataset) {
     if (dataset->GetCount(serie) < 2) {
       continue;
     }
 
-    for (size_t n = 0; n < dataset->GetCount(serie) - 1; n++) {
-      double x0 = dataset->GetX(n, serie);
-      double y0 = dataset->GetY(n, serie);
-      double x1 = dataset->GetX(n + 1, serie);
-      double y1 = dataset->GetY(n + 1, serie);
-
-      // check whether segment is visible
-      if (!horizAxis->IntersectsWindow(x0, x1) &&
-          !vertAxis->IntersectsWindow(y0, y1)) {
-        continue;
-      }
+    surface.SetPen(GetSerieStyle(serie).pen);
 
-      ClipHoriz(horizAxis, x0, y0, x1, y1);
-      ClipHoriz(horizAxis, x1, y1, x0, y0);
-      ClipVert(vertAxis, x0, y0, x1, y1);
-      ClipVert(vertAxis, x1, y1, x0, y0);
-
-      // translate to graphics coordinates.
-      wxCoord xg0, yg0;
-      wxCoord xg1, yg1;
-
-      xg0 = horizAxis->ToGraphics(dc, rc.x, rc.width, x0);
-      yg0 = vertAxis->ToGraphics(dc, rc.y, rc.height, y0);
-      xg1 = horizAxis->ToGraphics(dc, rc.x, rc.width, x1);
-      yg1 = vertAxis->ToGraphics(dc, rc.y, rc.height, y1);
-
-      wxPen *pen = GetSeriePen(serie);
-      dc.SetPen(*pen);
-      dc.DrawLine(xg0, yg0, xg1, yg1);
+    if (!DrawSerieLines(surface, clipper, dataset, serie, 0)) {
+      return ; // cancelled
     }
   }
 }
@@ -170,8 +270,13 @@ XYLineStepRenderer::~XYLineStepRenderer()
 {
 }
 
-void XYLineStepRenderer::DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+void XYLineStepRenderer::DrawLines(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
+	wxDC &dc = surface.GetDC();
+
+	SegmentClipper clipper(horizAxis->GetTransform(dc, rc.x, rc.width),
+			vertAxis->GetTransform(dc, rc.y, rc.height));
+
 	FOREACH_SERIE(serie, dataset) {
 		if (dataset->GetCount(serie) < 2) {
 			continue;
@@ -184,36 +289,10 @@ void XYLineStepRenderer::DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *v
 		}
 
 		// Set serie pen
-		wxPen *pen = GetSeriePen(serie);
-		dc.SetPen(*pen);
-
-		// iterate until two points will be invisible
-		for (size_t n = first; n < dataset->GetCount(serie) - 1; n++) {
-			double x0 = dataset->GetX(n, serie);
-			double y0 = dataset->GetY(n, serie);
-			double x1 = dataset->GetX(n + 1, serie);
-			double y1 = dataset->GetY(n + 1, serie);
-
-			if (!horizAxis->IntersectsWindow(x0, x1) ||
-					!vertAxis->IntersectsWindow(y0, y1)) {
-				break;
-			}
-
-			ClipHoriz(horizAxis, x0, y0, x1, y1);
-			ClipHoriz(horizAxis, x1, y1, x0, y0);
-			ClipVert(vertAxis, x0, y0, x1, y1);
-			ClipVert(vertAxis, x1, y1, x0, y0);
-
-			// translate to graphics coordinates.
-			wxCoord xg0, yg0;
-			wxCoord xg1, yg1;
-
-			xg0 = horizAxis->ToGraphics(dc, rc.x, rc.width, x0);
-			yg0 = vertAxis->ToGraphics(dc, rc.y, rc.height, y0);
-			xg1 = horizAxis->ToGraphics(dc, rc.x, rc.width, x1);
-			yg1 = vertAxis->ToGraphics(dc, rc.y, rc.height, y1);
-
-			dc.DrawLine(xg0, yg0, xg1, yg1);
+		surface.SetPen(GetSerieStyle(serie).pen);
+
+		if (!DrawSerieLines(surface, clipper, dataset, serie, first)) {
+			return ; // cancelled
 		}
 	}
 }
@@ -8,6 +8,9 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include <wx/xy/xyplot.h>
+#include <wx/xy/functions/functiondataset.h>
+
+#include <math.h>
 
 XYPlot::XYPlot()
 {
@@ -15,6 +18,9 @@ XYPlot::XYPlot()
 
 XYPlot::~XYPlot()
 {
+	for (size_t n = 0; n < m_functionSamples.size(); n++) {
+		delete m_functionSamples[n];
+	}
 }
 
 bool XYPlot::AcceptAxis(Axis *WXUNUSED(axis))
@@ -28,15 +34,94 @@ bool XYPlot::AcceptDataset(Dataset *dataset)
 }
 
 void XYPlot::DrawDatasets(wxDC &dc, wxRect rc)
+{
+	DCDrawSurface surface(dc);
+	DrawDatasets(surface, rc);
+}
+
+void XYPlot::DrawDatasets(DrawSurface &surface, wxRect rc)
 {
 	for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
+		if (surface.IsCancelled()) {
+			break;
+		}
+
 		XYDataset *dataset = (XYDataset *) GetDataset(nData);
-		DrawXYDataset(dc, rc, dataset);
+		DrawXYDataset(surface, rc, dataset);
 	}
 }
 
-void XYPlot::DrawXYDataset(wxDC &dc, wxRect rc, XYDataset *dataset)
+bool XYPlot::FindAppendedData(double &minX)
 {
+	std::vector<SerieState> serieStates;
+	bool appended = true;
+	bool found = false;
+
+	for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
+		XYDataset *dataset = wxDynamicCast(GetDataset(nData), XYDataset);
+		if (dataset == NULL) {
+			// can't check other datasets
+			appended = false;
+			continue;
+		}
+
+		for (size_t serie = 0; serie < dataset->GetSerieCount(); serie++) {
+			SerieState state;
+			state.count = dataset->GetCount(serie);
+			state.lastX = (state.count != 0) ? dataset->GetX(state.count - 1, serie) : 0;
+			state.lastY = (state.count != 0) ? dataset->GetY(state.count - 1, serie) : 0;
+
+			size_t index = serieStates.size();
+			serieStates.push_back(state);
+
+			if (!appended) {
+				continue;
+			}
+			if (index >= m_serieStates.size()) {
+				appended = false;
+				continue;
+			}
+
+			// check that old data is not changed
+			const SerieState &old = m_serieStates[index];
+			if (state.count < old.count) {
+				appended = false;
+				continue;
+			}
+			if (old.count != 0 && (dataset->GetX(old.count - 1, serie) != old.lastX ||
+					dataset->GetY(old.count - 1, serie) != old.lastY)) {
+				appended = false;
+				continue;
+			}
+
+			// appended points, and segment from last old point
+			if (state.count > old.count) {
+				size_t first = (old.count != 0) ? old.count - 1 : 0;
+
+				for (size_t n = first; n < state.count; n++) {
+					double x = dataset->GetX(n, serie);
+
+					if (!found || x < minX) {
+						minX = x;
+						found = true;
+					}
+				}
+			}
+		}
+	}
+
+	if (serieStates.size() != m_serieStates.size()) {
+		appended = false;
+	}
+
+	m_serieStates.swap(serieStates);
+	return appended;
+}
+
+void XYPlot::DrawXYDataset(DrawSurface &surface, wxRect rc, XYDataset *dataset)
+{
+	wxDC &dc = surface.GetDC();
+
 	XYRenderer *renderer = dataset->GetRenderer();
 	wxCHECK_RET(renderer != NULL, wxT("no renderer for data"));
 
@@ -46,6 +131,36 @@ void XYPlot::DrawXYDataset(wxDC &dc, wxRect rc, XYDataset *dataset)
 	wxCHECK_RET(vertAxis != NULL, wxT("no axis for data"));
 	wxCHECK_RET(horizAxis != NULL, wxT("no axis for data"));
 
-	renderer->Draw(dc, rc, horizAxis, vertAxis, dataset);
+	FunctionDataset *function = wxDynamicCast(dataset, FunctionDataset);
+	if (function != NULL) {
+		// sample function for visible part of data area
+		double minX = horizAxis->ToData(dc, rc.x, rc.width, rc.x);
+		double maxX = horizAxis->ToData(dc, rc.x, rc.width, rc.x + rc.width);
+		double minY = vertAxis->ToData(dc, rc.y, rc.height, rc.y + rc.height);
+		double maxY = vertAxis->ToData(dc, rc.y, rc.height, rc.y);
+
+		double yPixelSize = (rc.height > 0) ? fabs(maxY - minY) / rc.height : 0;
+
+		FunctionSamples *samples = GetFunctionSamples(function);
+		samples->Update(wxMin(minX, maxX), wxMax(minX, maxX), rc.width, yPixelSize);
+
+		renderer->Draw(surface, rc, horizAxis, vertAxis, samples);
+		return ;
+	}
+
+	renderer->Draw(surface, rc, horizAxis, vertAxis, dataset);
+}
+
+FunctionSamples *XYPlot::GetFunctionSamples(FunctionDataset *function)
+{
+	for (size_t n = 0; n < m_functionSamples.size(); n++) {
+		if (m_functionSamples[n]->GetFunction() == function) {
+			return m_functionSamples[n];
+		}
+	}
+
+	FunctionSamples *samples = new FunctionSamples(function);
+	m_functionSamples.push_back(samples);
+	return samples;
 }
 
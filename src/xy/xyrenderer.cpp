@@ -18,3 +18,14 @@ XYRenderer::XYRenderer()
 XYRenderer::~XYRenderer()
 {
 }
+
+void XYRenderer::Draw(DrawSurface &surface, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+{
+	if (surface.IsCancelled()) {
+		return ;
+	}
+
+	// drawings must be made in order
+	surface.Flush();
+	Draw(surface.GetDC(), rc, horizAxis, vertAxis, dataset);
+}
@@ -33,6 +33,10 @@ bool BubblePlot::AcceptDataset(Dataset *dataset)
 void BubblePlot::DrawDatasets(wxDC &dc, wxRect rc)
 {
 	for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
+		if (IsDrawCancelled()) {
+			break;
+		}
+
 		XYZDataset *dataset = (XYZDataset *) GetDataset(nData);
 		XYZRenderer *renderer = dataset->GetRenderer();
 		wxCHECK_RET(renderer != NULL, wxT("no renderer for data"));
@@ -9,42 +9,211 @@
 
 #include <wx/xyz/xyzdataset.h>
 
+#include <math.h>
+
+//
+// XYZGridIndex
+//
+
+XYZGridIndex::XYZGridIndex()
+{
+	m_minX = m_maxX = 0;
+	m_minY = m_maxY = 0;
+	m_cellsX = m_cellsY = 0;
+	m_built = false;
+}
+
+XYZGridIndex::~XYZGridIndex()
+{
+}
+
+void XYZGridIndex::Clear()
+{
+	m_cellStart.clear();
+	m_points.clear();
+	m_cellsX = m_cellsY = 0;
+	m_built = false;
+}
+
+size_t XYZGridIndex::CellX(double x)
+{
+	if (!(x > m_minX) || m_maxX <= m_minX) {
+		return 0;
+	}
+	size_t cell = (size_t) ((x - m_minX) / (m_maxX - m_minX) * m_cellsX);
+	return wxMin(cell, m_cellsX - 1);
+}
+
+size_t XYZGridIndex::CellY(double y)
+{
+	if (!(y > m_minY) || m_maxY <= m_minY) {
+		return 0;
+	}
+	size_t cell = (size_t) ((y - m_minY) / (m_maxY - m_minY) * m_cellsY);
+	return wxMin(cell, m_cellsY - 1);
+}
+
+void XYZGridIndex::Build(XYZDataset *dataset, size_t serie)
+{
+	const size_t count = dataset->GetCount(serie);
+
+	Clear();
+	m_built = true;
+
+	if (count == 0) {
+		return ;
+	}
+
+	std::vector<double> xs(count);
+	std::vector<double> ys(count);
+
+	for (size_t n = 0; n < count; n++) {
+		xs[n] = dataset->GetX(n, serie);
+		ys[n] = dataset->GetY(n, serie);
+
+		if (n == 0) {
+			m_minX = m_maxX = xs[n];
+			m_minY = m_maxY = ys[n];
+		}
+		else {
+			m_minX = wxMin(m_minX, xs[n]);
+			m_maxX = wxMax(m_maxX, xs[n]);
+			m_minY = wxMin(m_minY, ys[n]);
+			m_maxY = wxMax(m_maxY, ys[n]);
+		}
+	}
+
+	// about four points per cell
+	size_t cells = (size_t) sqrt(count / 4.0);
+	m_cellsX = m_cellsY = wxMax(cells, (size_t) 1);
+
+	// count points in cells, then place point indexes in cell order
+	m_cellStart.assign(m_cellsX * m_cellsY + 1, 0);
+	std::vector<size_t> pointCells(count);
+
+	for (size_t n = 0; n < count; n++) {
+		pointCells[n] = CellY(ys[n]) * m_cellsX + CellX(xs[n]);
+		m_cellStart[pointCells[n] + 1]++;
+	}
+
+	for (size_t cell = 0; cell < m_cellsX * m_cellsY; cell++) {
+		m_cellStart[cell + 1] += m_cellStart[cell];
+	}
+
+	std::vector<size_t> fill(m_cellStart.begin(), m_cellStart.end() - 1);
+	m_points.resize(count);
+	for (size_t n = 0; n < count; n++) {
+		m_points[fill[pointCells[n]]++] = n;
+	}
+}
+
+bool XYZGridIndex::IsInside(double minX, double maxX, double minY, double maxY)
+{
+	return m_minX >= minX && m_maxX <= maxX && m_minY >= minY && m_maxY <= maxY;
+}
+
+void XYZGridIndex::Find(double minX, double maxX, double minY, double maxY, std::vector<size_t> &points)
+{
+	if (m_points.size() == 0 ||
+			maxX < m_minX || minX > m_maxX ||
+			maxY < m_minY || minY > m_maxY) {
+		return ;
+	}
+
+	size_t cellX0 = CellX(minX);
+	size_t cellX1 = CellX(maxX);
+	size_t cellY0 = CellY(minY);
+	size_t cellY1 = CellY(maxY);
+
+	for (size_t cellY = cellY0; cellY <= cellY1; cellY++) {
+		size_t first = m_cellStart[cellY * m_cellsX + cellX0];
+		size_t last = m_cellStart[cellY * m_cellsX + cellX1 + 1];
+
+		// cells in row are continuous in points array
+		points.insert(points.end(), m_points.begin() + first, m_points.begin() + last);
+	}
+}
+
+//
+// XYZDataset
+//
+
 XYZDataset::XYZDataset()
 {
+	m_zRangeValid = false;
+	m_minZ = 0;
+	m_maxZ = 0;
 }
 
 XYZDataset::~XYZDataset()
 {
 }
 
-double XYZDataset::GetMinZ()
+void XYZDataset::UpdateZRange()
 {
-	double minZ = 0;
+	if (m_zRangeValid) {
+		return ;
+	}
 
+	m_minZ = 0;
+	m_maxZ = 0;
+
+	bool first = true;
 	for (size_t serie = 0; serie < GetSerieCount(); serie++) {
 		for (size_t n = 0; n < GetCount(serie); n++) {
 			double z = GetZ(n, serie);
-			if (n == 0 && serie == 0)
-				minZ = z;
-			else
-				minZ = wxMin(minZ, z);
+			if (first) {
+				m_minZ = m_maxZ = z;
+				first = false;
+			}
+			else {
+				m_minZ = wxMin(m_minZ, z);
+				m_maxZ = wxMax(m_maxZ, z);
+			}
 		}
 	}
-	return minZ;
+
+	m_zRangeValid = true;
+}
+
+double XYZDataset::GetMinZ()
+{
+	UpdateZRange();
+	return m_minZ;
 }
 
 double XYZDataset::GetMaxZ()
 {
-	double maxZ = 0;
+	UpdateZRange();
+	return m_maxZ;
+}
 
-	for (size_t serie = 0; serie < GetSerieCount(); serie++) {
-		for (size_t n = 0; n < GetCount(serie); n++) {
-			double z = GetZ(n, serie);
-			if (n == 0 && serie == 0)
-				maxZ = z;
-			else
-				maxZ = wxMax(maxZ, z);
-		}
+bool XYZDataset::FindPoints(size_t serie, double minX, double maxX, double minY, double maxY, std::vector<size_t> &points)
+{
+	wxCHECK_MSG(serie < GetSerieCount(), false, wxT("XYZDataset::FindPoints: Serie index is out of range"));
+
+	if (m_gridIndexes.size() != GetSerieCount()) {
+		m_gridIndexes.clear();
+		m_gridIndexes.resize(GetSerieCount());
 	}
-	return maxZ;
+
+	XYZGridIndex &gridIndex = m_gridIndexes[serie];
+	if (!gridIndex.IsBuilt()) {
+		gridIndex.Build(this, serie);
+	}
+
+	if (gridIndex.IsInside(minX, maxX, minY, maxY)) {
+		return false;
+	}
+
+	gridIndex.Find(minX, maxX, minY, maxY, points);
+	return true;
+}
+
+void XYZDataset::InvalidateCaches()
+{
+	XYDataset::InvalidateCaches();
+
+	m_zRangeValid = false;
+	m_gridIndexes.clear();
 }
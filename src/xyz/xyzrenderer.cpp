@@ -10,6 +10,8 @@
 
 #include "wx/xyz/xyzrenderer.h"
 
+#include <algorithm>
+
 IMPLEMENT_CLASS(XYZRenderer, Renderer)
 
 XYZRenderer::XYZRenderer(int minRad, int maxRad)
@@ -20,6 +22,8 @@ XYZRenderer::XYZRenderer(int minRad, int maxRad)
 	m_defaultPenWidth = 1;
 	m_defaultPenStyle = wxPENSTYLE_SOLID;
 	m_defaultBrushStyle = wxBRUSHSTYLE_SOLID;
+
+	m_bubbleCulling = true;
 }
 
 XYZRenderer::~XYZRenderer()
@@ -31,14 +35,62 @@ void XYZRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYZ
 	double minZ = dataset->GetMinZ();
 	double maxZ = dataset->GetMaxZ();
 
-	double k = (m_maxRad - m_minRad) / (maxZ - minZ);
+	double k = (maxZ > minZ) ? (m_maxRad - m_minRad) / (maxZ - minZ) : 0;
+
+	//
+	// Data area extended by maximal bubble radius and half of outline
+	// width, bubbles with center outside of data area can reach it.
+	//
+	wxCoord maxPenWidth = 0;
+	FOREACH_SERIE(serie, dataset) {
+		maxPenWidth = wxMax(maxPenWidth, GetSerieStyle(serie).pen.GetWidth());
+	}
+
+	wxCoord maxRad = wxMax(m_minRad, m_maxRad) + maxPenWidth / 2 + 1;
+
+	double x0 = horizAxis->ToData(dc, rc.x, rc.width, rc.x - maxRad);
+	double x1 = horizAxis->ToData(dc, rc.x, rc.width, rc.x + rc.width + maxRad);
+	double y0 = vertAxis->ToData(dc, rc.y, rc.height, rc.y - maxRad);
+	double y1 = vertAxis->ToData(dc, rc.y, rc.height, rc.y + rc.height + maxRad);
 
+	// don't cull for degenerated data area
+	bool cull = (x0 != x1) && (y0 != y1);
+
+	std::vector<size_t> points;
+
+	AxisTransform horizTransform = horizAxis->GetTransform(dc, rc.x, rc.width);
+	AxisTransform vertTransform = vertAxis->GetTransform(dc, rc.y, rc.height);
+
+	m_bubbleOccupancy.ResetCulledCount();
 
 	FOREACH_SERIE(serie, dataset) {
-		dc.SetPen(*GetSeriePen(serie));
-		dc.SetBrush(*GetSerieBrush(serie));
+		const SerieStyle &style = GetSerieStyle(serie);
+
+		dc.SetPen(style.pen);
+		dc.SetBrush(style.brush);
+
+		points.clear();
+		bool indexed = cull && dataset->FindPoints(serie,
+				wxMin(x0, x1), wxMax(x0, x1), wxMin(y0, y1), wxMax(y0, y1), points);
+		if (indexed) {
+			// keep drawing order of overlapping bubbles
+			std::sort(points.begin(), points.end());
+		}
+
+		const size_t count = indexed ? points.size() : dataset->GetCount(serie);
+		const wxCoord penWidth = style.pen.GetWidth();
+
+		//
+		// Bubbles of the same serie with the same center and radius
+		// look the same, and when outline and fill colours are equal,
+		// drawing order doesn't matter, so draw them only once.
+		//
+		bool mergeBubbles = m_bubbleCulling && (style.pen.GetColour() == style.brush.GetColour());
+		m_bubbleOccupancy.Reset(rc);
+
+		for (size_t i = 0; i < count; i++) {
+			size_t n = indexed ? points[i] : i;
 
-		FOREACH_DATAITEM(n, serie, dataset) {
 			double xVal;
 			double yVal;
 			double zVal;
@@ -47,16 +99,45 @@ void XYZRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYZ
 			yVal = dataset->GetY(n, serie);
 			zVal = dataset->GetZ(n, serie);
 
-			wxCoord x = horizAxis->ToGraphics(dc, rc.x, rc.width, xVal);
-			wxCoord y = vertAxis->ToGraphics(dc, rc.y, rc.height, yVal);
+			wxCoord x = horizTransform.ToGraphics(xVal);
+			wxCoord y = vertTransform.ToGraphics(yVal);
 
 			wxCoord r = (wxCoord) ((zVal - minZ) * k + m_minRad);
 
+			if (cull) {
+				wxCoord extent = ((r < 0) ? -r : r) + penWidth;
+				if (x + extent < rc.x || x - extent > rc.x + rc.width ||
+						y + extent < rc.y || y - extent > rc.y + rc.height) {
+					continue;
+				}
+			}
+
+			// only small radiuses are tracked
+			if (mergeBubbles && r >= 0 && !m_bubbleOccupancy.Occupy(x, y, (size_t) r)) {
+				continue;
+			}
+
 			dc.DrawCircle(x, y, r);
 		}
 	}
 }
 
+void XYZRenderer::ResolveSerieStyle(size_t serie, SerieStyle &style)
+{
+	Renderer::ResolveSerieStyle(serie, style);
+	style.colour = GetSerieColor(serie);
+	style.pen = *GetSeriePen(serie);
+	style.brush = *GetSerieBrush(serie);
+}
+
+void XYZRenderer::SetBubbleCulling(bool bubbleCulling)
+{
+	if (m_bubbleCulling != bubbleCulling) {
+		m_bubbleCulling = bubbleCulling;
+		FireNeedRedraw();
+	}
+}
+
 void XYZRenderer::SetSeriePen(size_t serie, wxPen *pen)
 {
 	m_seriePens[serie] = *pen;
@@ -65,8 +146,11 @@ void XYZRenderer::SetSeriePen(size_t serie, wxPen *pen)
 
 void XYZRenderer::SetSerieColor(size_t serie, wxColour *color)
 {
-	SetSeriePen(serie, wxThePenList->FindOrCreatePen(*color, m_defaultPenWidth, m_defaultPenStyle));
-	SetSerieBrush(serie, wxTheBrushList->FindOrCreateBrush(*color, m_defaultBrushStyle));
+	wxPen pen(*color, m_defaultPenWidth, m_defaultPenStyle);
+	wxBrush brush(*color, m_defaultBrushStyle);
+
+	SetSeriePen(serie, &pen);
+	SetSerieBrush(serie, &brush);
 }
 
 wxColour XYZRenderer::GetSerieColor(size_t serie)
@@ -80,7 +164,9 @@ wxColour XYZRenderer::GetSerieColor(size_t serie)
 wxPen *XYZRenderer::GetSeriePen(size_t serie)
 {
 	if (m_seriePens.find(serie) == m_seriePens.end()) {
-		return wxThePenList->FindOrCreatePen(GetDefaultColour(serie), m_defaultPenWidth, m_defaultPenStyle);
+		// default pen is kept by renderer, global pen list
+		// can't be used while drawing in worker thread
+		m_seriePens[serie] = wxPen(GetDefaultColour(serie), m_defaultPenWidth, m_defaultPenStyle);
 	}
 	return &m_seriePens[serie];
 }
@@ -94,7 +180,7 @@ void XYZRenderer::SetSerieBrush(size_t serie, wxBrush *brush)
 wxBrush *XYZRenderer::GetSerieBrush(size_t serie)
 {
 	if (m_serieBrushs.find(serie) == m_serieBrushs.end()) {
-		return wxTheBrushList->FindOrCreateBrush(GetDefaultColour(serie), m_defaultBrushStyle);
+		m_serieBrushs[serie] = wxBrush(GetDefaultColour(serie), m_defaultBrushStyle);
 	}
 	return &m_serieBrushs[serie];
 }